@@ -0,0 +1,630 @@
+/**
+ * @file benchmarks.cpp
+ * @brief Benchmarks for the Detail_info class using Google Benchmark.
+ */
+
+#include <benchmark/benchmark.h>
+#include <expected>
+#include <format>
+#include <random>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../detail.hpp"
+#include "../detail_decoder.hpp"
+#include "../detail_index.hpp"
+#include "../detail_reader.hpp"
+#include "../detail_store.hpp"
+#include "../detail_table.hpp"
+#include "../parallel_decoder.hpp"
+
+using std::string;
+
+/**
+ * @brief Registers the small, medium and large field sizes as benchmark arguments.
+ * @param bench The benchmark to configure.
+ */
+static void
+field_sizes(benchmark::internal::Benchmark* bench) {
+    bench->ArgName("field")->Arg(8)->Arg(256)->Arg(4096);
+}
+
+/**
+ * @brief Reference decoder with the regex used before the hand-written scanner.
+ * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+ * @return true if the string matched.
+ */
+static bool
+regex_decode(const string& str) {
+    std::regex pattern(
+        R"(\s*\{\s*'id'\s*:\s*'([^']*)'\s*,\s*'name'\s*:\s*'([^']*)'\s*,\s*'count'\s*:\s*(\d+)\s*\}\s*)");
+    std::smatch matches;
+    return std::regex_search(str, matches, pattern);
+}
+
+/**
+ * @brief Reference encoder with the std::format call used before encode_to().
+ * @param detail The detail to encode.
+ * @return The encoded record.
+ */
+static string
+format_encode(const Detail_info& detail) {
+    return std::format("{{'id':'{}','name':'{}','count':{}}}", detail.get_id(), detail.get_name(), detail.get_count());
+}
+
+/**
+ * @brief Builds an encoded record whose id and name have the given length.
+ * @param length Length of the id and name fields.
+ * @return The encoded record.
+ */
+static string
+make_record(std::size_t length) {
+    return Detail_info(string(length, 'i'), string(length, 'n'), 12345).encode();
+}
+
+/**
+ * @brief Decoding with the regex reference.
+ */
+static void
+BM_DecodeRegex(benchmark::State& state) {
+    string record = make_record(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(regex_decode(record));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * record.size());
+}
+
+BENCHMARK(BM_DecodeRegex)->Apply(field_sizes);
+
+/**
+ * @brief Decoding with Detail_info::decode.
+ */
+static void
+BM_Decode(benchmark::State& state) {
+    string record = make_record(state.range(0));
+    Detail_info detail;
+    for (auto _ : state) {
+        detail.decode(record);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * record.size());
+}
+
+BENCHMARK(BM_Decode)->Apply(field_sizes);
+
+/**
+ * @brief Decoding a C-style string with Detail_info::decode.
+ */
+static void
+BM_DecodeCString(benchmark::State& state) {
+    string record = make_record(state.range(0));
+    Detail_info detail;
+    for (auto _ : state) {
+        detail.decode(record.c_str());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * record.size());
+}
+
+BENCHMARK(BM_DecodeCString)->Apply(field_sizes);
+
+/**
+ * @brief Decoding a C-style string of known size with Detail_info::decode.
+ */
+static void
+BM_DecodeCStringSize(benchmark::State& state) {
+    string record = make_record(state.range(0));
+    Detail_info detail;
+    for (auto _ : state) {
+        detail.decode(record.data(), record.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * record.size());
+}
+
+BENCHMARK(BM_DecodeCStringSize)->Apply(field_sizes);
+
+/**
+ * @brief Decoding a std::string_view with Detail_info::decode.
+ */
+static void
+BM_DecodeStringView(benchmark::State& state) {
+    string record = make_record(state.range(0));
+    Detail_info detail;
+    for (auto _ : state) {
+        detail.decode(std::string_view(record));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * record.size());
+}
+
+BENCHMARK(BM_DecodeStringView)->Apply(field_sizes);
+
+/**
+ * @brief Decoding into a non-owning Detail_view.
+ */
+static void
+BM_DecodeView(benchmark::State& state) {
+    string record = make_record(state.range(0));
+    Detail_view view;
+    for (auto _ : state) {
+        view.decode(record);
+        benchmark::DoNotOptimize(view);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * record.size());
+}
+
+BENCHMARK(BM_DecodeView)->Apply(field_sizes);
+
+/**
+ * @brief Decoding the binary format into a non-owning Detail_view.
+ */
+static void
+BM_DecodeBinaryView(benchmark::State& state) {
+    string record;
+    Detail_info(string(state.range(0), 'i'), string(state.range(0), 'n'), 12345).encode_binary(record);
+    Detail_view view;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.decode_binary(record));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * record.size());
+}
+
+BENCHMARK(BM_DecodeBinaryView)->Apply(field_sizes);
+
+/**
+ * @brief Encoding a single detail with Detail_info::encode.
+ */
+static void
+BM_Encode(benchmark::State& state) {
+    Detail_info detail(string(state.range(0), 'i'), string(state.range(0), 'n'), 12345);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(detail.encode());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * detail.encoded_size());
+}
+
+BENCHMARK(BM_Encode)->Apply(field_sizes);
+
+/**
+ * @brief Encoding and decoding a detail through one reused buffer.
+ */
+static void
+BM_RoundTrip(benchmark::State& state) {
+    Detail_info detail(string(state.range(0), 'i'), string(state.range(0), 'n'), 12345), decoded;
+    string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        detail.encode_to(buffer);
+        decoded.decode(std::string_view(buffer));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+BENCHMARK(BM_RoundTrip)->Apply(field_sizes);
+
+/**
+ * @brief Encoding and decoding a detail in the binary format through one reused buffer.
+ */
+static void
+BM_RoundTripBinary(benchmark::State& state) {
+    Detail_info detail(string(state.range(0), 'i'), string(state.range(0), 'n'), 12345), decoded;
+    string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        detail.encode_binary(buffer);
+        decoded.decode_binary(buffer);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+BENCHMARK(BM_RoundTripBinary)->Apply(field_sizes);
+
+/**
+ * @brief Builds 10^4 records of which the given percentage lack the count field.
+ * @param percent Percentage of malformed records.
+ * @return The encoded records.
+ */
+static std::vector<string>
+make_dirty(std::size_t percent) {
+    std::mt19937 random(42);
+    std::vector<string> records;
+    for (std::size_t i = 0; i < 10000; ++i) {
+        string record = Detail_info("id" + std::to_string(i), "name", i).encode();
+        if (random() % 100 < percent) {
+            record.erase(record.find(",'count'"));
+        }
+        records.push_back(std::move(record));
+    }
+    return records;
+}
+
+/**
+ * @brief Decoding records with a given share of malformed ones, catching the exception of each failure.
+ */
+static void
+BM_DecodeDirtyThrow(benchmark::State& state) {
+    std::vector<string> records = make_dirty(state.range(0));
+    Detail_info detail;
+    for (auto _ : state) {
+        std::size_t bad = 0;
+        for (const string& record : records) {
+            try {
+                detail.decode(std::string_view(record));
+            } catch (errors) {
+                ++bad;
+            }
+        }
+        benchmark::DoNotOptimize(bad);
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+
+BENCHMARK(BM_DecodeDirtyThrow)->ArgName("malformed")->Arg(0)->Arg(10)->Arg(50)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Decoding records with a given share of malformed ones through try_decode().
+ */
+static void
+BM_DecodeDirtyExpected(benchmark::State& state) {
+    std::vector<string> records = make_dirty(state.range(0));
+    for (auto _ : state) {
+        std::size_t bad = 0;
+        for (const string& record : records) {
+            std::expected<Detail_info, Decode_error> detail = Detail_info::try_decode(record);
+            bad += !detail;
+            benchmark::DoNotOptimize(detail);
+        }
+        benchmark::DoNotOptimize(bad);
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+
+BENCHMARK(BM_DecodeDirtyExpected)->ArgName("malformed")->Arg(0)->Arg(10)->Arg(50)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Batch decoding of 10^4 newline-delimited records with Detail_reader.
+ */
+static void
+BM_DecodeReader(benchmark::State& state) {
+    string input;
+    for (std::size_t i = 0; i < 10000; ++i) {
+        Detail_info(string(state.range(0), 'i'), string(state.range(0), 'n'), i).encode_to(input);
+        input += '\n';
+    }
+    std::vector<Detail_info> details;
+    std::vector<std::size_t> bad_lines;
+    details.reserve(10000);
+    for (auto _ : state) {
+        std::istringstream in(input);
+        Detail_reader reader(in);
+        details.clear();
+        benchmark::DoNotOptimize(reader.read(details, bad_lines));
+    }
+    state.SetItemsProcessed(state.iterations() * 10000);
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+BENCHMARK(BM_DecodeReader)->Apply(field_sizes)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Incremental decoding of 10^4 records arriving in 1460-byte chunks, the TCP payload of an Ethernet frame.
+ */
+static void
+BM_DecodeIncremental(benchmark::State& state) {
+    string input;
+    for (std::size_t i = 0; i < 10000; ++i) {
+        Detail_info(string(state.range(0), 'i'), string(state.range(0), 'n'), i).encode_to(input);
+        input += '\n';
+    }
+    std::vector<Detail_info> details;
+    details.reserve(10000);
+    for (auto _ : state) {
+        Detail_decoder decoder;
+        details.clear();
+        for (std::size_t begin = 0; begin < input.size(); begin += 1460) {
+            decoder.feed(std::string_view(input).substr(begin, 1460), details);
+        }
+        benchmark::DoNotOptimize(details.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 10000);
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+BENCHMARK(BM_DecodeIncremental)->Apply(field_sizes)->Unit(benchmark::kMicrosecond);
+
+/**
+ * @brief Builds a batch of details whose id and name have the given length.
+ * @param length Length of the id and name fields.
+ * @return 1000 details.
+ */
+static std::vector<Detail_info>
+make_batch(std::size_t length) {
+    std::vector<Detail_info> details;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        details.emplace_back(string(length, 'i'), string(length, 'n'), i * 1000003);
+    }
+    return details;
+}
+
+/**
+ * @brief Serialising a batch into one buffer with the std::format reference.
+ */
+static void
+BM_EncodeFormatBatch(benchmark::State& state) {
+    std::vector<Detail_info> details = make_batch(state.range(0));
+    string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        for (const Detail_info& detail : details) {
+            buffer += format_encode(detail);
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * details.size());
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+BENCHMARK(BM_EncodeFormatBatch)->Apply(field_sizes);
+
+/**
+ * @brief Serialising a batch into one buffer with Detail_info::encode().
+ */
+static void
+BM_EncodeBatch(benchmark::State& state) {
+    std::vector<Detail_info> details = make_batch(state.range(0));
+    string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        for (Detail_info& detail : details) {
+            buffer += detail.encode();
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * details.size());
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+BENCHMARK(BM_EncodeBatch)->Apply(field_sizes);
+
+/**
+ * @brief Serialising a batch into one reused buffer with Detail_info::encode_to().
+ */
+static void
+BM_EncodeToBatch(benchmark::State& state) {
+    std::vector<Detail_info> details = make_batch(state.range(0));
+    string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        for (const Detail_info& detail : details) {
+            detail.encode_to(buffer);
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * details.size());
+    state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+BENCHMARK(BM_EncodeToBatch)->Apply(field_sizes);
+
+/**
+ * @brief Decoding 10^5 newline-delimited records with decode_parallel on 1..N threads.
+ */
+static void
+BM_DecodeParallel(benchmark::State& state) {
+    string input;
+    for (std::size_t i = 0; i < 100000; ++i) {
+        Detail_info(std::to_string(i), string(32, 'n'), i).encode_to(input);
+        input += '\n';
+    }
+    for (auto _ : state) {
+        std::vector<Detail_info> details;
+        std::vector<std::size_t> bad_lines;
+        benchmark::DoNotOptimize(decode_parallel(input, details, bad_lines, state.range(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * 100000);
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+BENCHMARK(BM_DecodeParallel)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Builds 10^6 details with 16 distinct names and ids sharing a long prefix.
+ * @return The details.
+ */
+static std::vector<Detail_info>
+make_catalog() {
+    std::vector<Detail_info> details;
+    details.reserve(1000000);
+    for (std::size_t i = 0; i < 1000000; ++i) {
+        details.emplace_back("warehouse-7/part-" + std::to_string(i), "Name" + std::to_string(i % 16), i);
+    }
+    return details;
+}
+
+/**
+ * @brief Summing the counts of one name over a std::vector<Detail_info>.
+ */
+static void
+BM_ScanVector(benchmark::State& state) {
+    std::vector<Detail_info> details = make_catalog();
+    for (auto _ : state) {
+        std::size_t total = 0;
+        for (const Detail_info& detail : details) {
+            if (detail.get_name() == "Name3") {
+                total += detail.get_count();
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * details.size());
+    state.counters["bytes_per_record"] = sizeof(Detail_info) + (details[0].get_id().size() + 1);
+}
+
+BENCHMARK(BM_ScanVector)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Summing the counts of one name over a Detail_store.
+ */
+static void
+BM_ScanStore(benchmark::State& state) {
+    Detail_store store;
+    store.reserve(1000000);
+    for (const Detail_info& detail : make_catalog()) {
+        store.add(detail.view());
+    }
+    for (auto _ : state) {
+        std::size_t total = 0;
+        for (const Detail_view& view : store) {
+            if (view.name == "Name3") {
+                total += view.count;
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * store.size());
+    state.counters["bytes_per_record"] = double(store.memory_usage()) / store.size();
+}
+
+BENCHMARK(BM_ScanStore)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Summing the counts of one name over a Detail_table.
+ */
+static void
+BM_SumByNameTable(benchmark::State& state) {
+    Detail_table table(make_catalog());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.sum("Name3"));
+    }
+    state.SetItemsProcessed(state.iterations() * table.size());
+}
+
+BENCHMARK(BM_SumByNameTable)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Grouping the counts by name over a Detail_table.
+ */
+static void
+BM_GroupByNameTable(benchmark::State& state) {
+    Detail_table table(make_catalog());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.group_by_name());
+    }
+    state.SetItemsProcessed(state.iterations() * table.size());
+}
+
+BENCHMARK(BM_GroupByNameTable)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Builds the given number of details with ids "part-<n>".
+ * @param count Number of details.
+ * @return The details.
+ */
+static std::vector<Detail_info>
+make_ids(std::size_t count) {
+    std::vector<Detail_info> details;
+    details.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        details.emplace_back("part-" + std::to_string(i), "Bolt", i);
+    }
+    return details;
+}
+
+/**
+ * @brief Builds random existing ids to look up.
+ * @param count Number of details in the batch.
+ * @return 4096 ids.
+ */
+static std::vector<string>
+make_queries(std::size_t count) {
+    std::mt19937_64 gen(7);
+    std::vector<string> queries;
+    for (int i = 0; i < 4096; ++i) {
+        queries.push_back("part-" + std::to_string(gen() % count));
+    }
+    return queries;
+}
+
+/**
+ * @brief Point lookups by id with Detail_index.
+ */
+static void
+BM_IndexFind(benchmark::State& state) {
+    std::vector<Detail_info> details = make_ids(state.range(0));
+    std::vector<string> queries = make_queries(details.size());
+    Detail_index index(details);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.find(queries[i++ & 4095]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_IndexFind)->ArgName("records")->Arg(1000000)->Arg(10000000);
+
+/**
+ * @brief Point lookups by id with std::unordered_map, for comparison.
+ */
+static void
+BM_UnorderedMapFind(benchmark::State& state) {
+    std::vector<Detail_info> details = make_ids(state.range(0));
+    std::vector<string> queries = make_queries(details.size());
+    std::unordered_map<std::string_view, const Detail_info*> index;
+    for (const Detail_info& detail : details) {
+        index.emplace(detail.get_id(), &detail);
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.find(queries[i++ & 4095]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_UnorderedMapFind)->ArgName("records")->Arg(1000000)->Arg(10000000);
+
+/**
+ * @brief Prefix queries matching about ten ids with the sorted Detail_index.
+ */
+static void
+BM_IndexPrefix(benchmark::State& state) {
+    std::vector<Detail_info> details = make_ids(state.range(0));
+    std::vector<string> queries = make_queries(details.size() / 10);
+    Detail_index index(details, true);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.prefix(queries[i++ & 4095]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_IndexPrefix)->ArgName("records")->Arg(1000000)->Arg(10000000);
+
+/**
+ * @brief Building the hash index over a batch.
+ */
+static void
+BM_IndexBuild(benchmark::State& state) {
+    std::vector<Detail_info> details = make_ids(state.range(0));
+    for (auto _ : state) {
+        Detail_index index(details);
+        benchmark::DoNotOptimize(index.find("part-0"));
+    }
+    state.SetItemsProcessed(state.iterations() * details.size());
+}
+
+BENCHMARK(BM_IndexBuild)->ArgName("records")->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
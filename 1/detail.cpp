@@ -4,10 +4,10 @@
  */
 
 #include "detail.hpp"
-#include <format>
 #include <iostream>
-#include <regex>
+#include <limits>
 #include <string>
+#include <string_view>
 
 using std::cout;
 using std::endl;
@@ -28,11 +28,17 @@ Detail_info::init(const string& id, const string& name, std::size_t count) {
 
 /**
  * @brief Encodes the detail information into a JSON-like string.
+ *
+ * The returned string is owned by the caller and may be kept for long, so it is allocated with the
+ * exact encoded size rather than the longest possible encoding that encode_to() reserves.
+ *
  * @return A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
  */
 string
 Detail_info::encode() {
-    return std::format("{{'id':'{}','name':'{}','count':{}}}", this->id, this->name, this->count);
+    string result(this->encoded_size(), '\0');
+    this->encode_to(result.data());
+    return result;
 }
 
 /**
@@ -49,32 +55,346 @@ Detail_info::encode(const string& id, const string& name, std::size_t count) {
 }
 
 /**
- * @brief Decodes a JSON-like string and extracts the detail information.
+ * @brief Appends the encoded detail to a caller-owned string.
+ * @param out The string to append to; no other memory is allocated.
+ */
+void
+Detail_info::encode_to(string& out) const {
+    this->view().encode_to(out);
+}
+
+/**
+ * @brief Appends the encoded detail to a caller-owned character vector.
+ * @param out The vector to append to; no other memory is allocated.
+ */
+void
+Detail_info::encode_to(std::vector<char>& out) const {
+    std::size_t offset = out.size();
+    out.resize(offset + this->encoded_size());
+    this->encode_to(out.data() + offset);
+}
+
+/**
+ * @brief Returns the length of the encoded detail.
+ * @return The number of characters written by encode_to().
+ */
+std::size_t
+Detail_info::encoded_size() const {
+    return this->view().encoded_size();
+}
+
+/**
+ * @brief Appends the detail in the binary format to a caller-owned string.
+ * @param out The string to append to.
+ */
+void
+Detail_info::encode_binary(string& out) const {
+    this->view().encode_binary(out);
+}
+
+/**
+ * @brief Decodes one detail in the binary format.
+ * @param data Binary data starting with the detail; trailing bytes are ignored.
+ * @return The number of bytes consumed.
+ * @throws errors::BAD_BINARY if the data is truncated or malformed.
+ */
+std::size_t
+Detail_info::decode_binary(std::string_view data) {
+    Detail_view view;
+    std::size_t consumed = view.decode_binary(data);
+    this->id.assign(view.id);
+    this->name.assign(view.name);
+    this->count = view.count;
+    return consumed;
+}
+
+/**
+ * @brief Returns a view of the fields, valid while the detail is alive and unchanged.
+ * @return A Detail_view of the detail.
+ */
+Detail_view
+Detail_info::view() const {
+    return Detail_view{this->id, this->name, this->count};
+}
+
+/**
+ * @brief Returns the ID of the detail.
+ * @return The ID of the detail.
+ */
+const string&
+Detail_info::get_id() const {
+    return this->id;
+}
+
+/**
+ * @brief Returns the name of the detail.
+ * @return The name of the detail.
+ */
+const string&
+Detail_info::get_name() const {
+    return this->name;
+}
+
+/**
+ * @brief Returns the count of the detail.
+ * @return The count of the detail.
+ */
+std::size_t
+Detail_info::get_count() const {
+    return this->count;
+}
+
+/**
+ * @brief Appends the encoded detail to a caller-owned string.
+ *
+ * The string is grown by the longest possible encoding, with every field character escaped and
+ * the longest count, so the fields are scanned only once while they are written.
+ *
+ * @param out The string to append to; no other memory is allocated.
+ */
+void
+Detail_view::encode_to(string& out) const {
+    std::size_t offset = out.size();
+    std::size_t longest = Detail_schema::max_encoded_size(*this);
+    out.resize_and_overwrite(offset + longest, [this, offset](char* data, std::size_t) {
+        return this->encode_to(data + offset) - data;
+    });
+}
+
+/**
+ * @brief Returns the length of the encoded detail.
+ * @return The number of characters written by encode_to().
+ */
+std::size_t
+Detail_view::encoded_size() const {
+    return Detail_schema::encoded_size(*this);
+}
+
+namespace {
+
+/**
+ * @brief Appends a varint, 7 bits per byte starting with the lowest.
+ * @param out The string to append to.
+ * @param value The value to append.
+ */
+inline void
+put_varint(string& out, std::size_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+/**
+ * @brief Reads a varint.
+ * @param data The remaining data, advanced past the varint.
+ * @return The value read.
+ * @throws errors::BAD_BINARY if the varint is truncated or does not fit into std::size_t.
+ */
+inline std::size_t
+get_varint(std::string_view& data) {
+    std::size_t value = 0;
+    for (unsigned shift = 0; shift < std::numeric_limits<std::size_t>::digits && !data.empty(); shift += 7) {
+        auto byte = static_cast<unsigned char>(data.front());
+        data.remove_prefix(1);
+        std::size_t bits = byte & 0x7f;
+        if ((bits << shift) >> shift != bits) {
+            throw BAD_BINARY;
+        }
+        value |= bits << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw BAD_BINARY;
+}
+
+/**
+ * @brief Reads a varint length followed by that many bytes.
+ * @param data The remaining data, advanced past the field.
+ * @return The bytes of the field.
+ * @throws errors::BAD_BINARY if the field is truncated.
+ */
+inline std::string_view
+get_field(std::string_view& data) {
+    std::size_t length = get_varint(data);
+    if (length > data.size()) {
+        throw BAD_BINARY;
+    }
+    std::string_view field = data.substr(0, length);
+    data.remove_prefix(length);
+    return field;
+}
+
+} // namespace
+
+/**
+ * @brief Appends the detail in the binary format to a caller-owned string.
+ * @param out The string to append to.
+ */
+void
+Detail_view::encode_binary(string& out) const {
+    put_varint(out, this->id.size());
+    out.append(this->id);
+    put_varint(out, this->name.size());
+    out.append(this->name);
+    put_varint(out, this->count);
+}
+
+/**
+ * @brief Decodes one detail in the binary format without copying the fields.
+ * @param data Binary data starting with the detail; trailing bytes are ignored.
+ * @return The number of bytes consumed.
+ * @throws errors::BAD_BINARY if the data is truncated or malformed.
+ */
+std::size_t
+Detail_view::decode_binary(std::string_view data) {
+    std::size_t size = data.size();
+    std::string_view id = get_field(data);
+    std::string_view name = get_field(data);
+    this->count = get_varint(data);
+    this->id = id;
+    this->name = name;
+    return size - data.size();
+}
+
+/**
+ * @brief Converts the first JSON-like record in a string to the binary format.
+ * @param text A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+ * @param out The string the binary record is appended to.
+ * @throws errors::BAD_JSON if the string is not in the expected format.
+ */
+void
+text_to_binary(std::string_view text, string& out) {
+    Detail_view view;
+    string buffer;
+    view.decode(text, buffer);
+    view.encode_binary(out);
+}
+
+/**
+ * @brief Converts one binary record to the JSON-like format.
+ * @param data Binary data starting with the record.
+ * @param out The string the JSON-like record is appended to.
+ * @return The number of bytes consumed from data.
+ * @throws errors::BAD_BINARY if the data is truncated or malformed.
+ */
+std::size_t
+binary_to_text(std::string_view data, string& out) {
+    Detail_view view;
+    std::size_t consumed = view.decode_binary(data);
+    std::size_t offset = out.size();
+    out.resize(offset + view.encoded_size());
+    view.encode_to(out.data() + offset);
+    return consumed;
+}
+
+/**
+ * @brief Decodes a JSON-like string without copying the fields and without throwing.
+ * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+ * @return The decoded view, or the position and reason of the failure.
+ */
+std::expected<Detail_view, Decode_error>
+Detail_view::try_decode(std::string_view str) noexcept {
+    Detail_view view;
+    Decode_error error;
+    if (!Detail_schema::find(str.data(), str.data() + str.size(), view, error, nullptr)) {
+        return std::unexpected(error);
+    }
+    return view;
+}
+
+/**
+ * @brief Decodes a JSON-like string without throwing, unescaping fields with escape sequences into a buffer.
  * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+ * @param buffer Cleared and then receives the unescaped fields; other fields are not copied.
+ * @return The decoded view, or the position and reason of the failure.
+ */
+std::expected<Detail_view, Decode_error>
+Detail_view::try_decode(std::string_view str, string& buffer) {
+    Detail_view view;
+    Decode_error error;
+    if (!Detail_schema::find(str.data(), str.data() + str.size(), view, error, &buffer)) {
+        return std::unexpected(error);
+    }
+    return view;
+}
+
+/**
+ * @brief Decodes a JSON-like string without copying the fields.
+ * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+ * @throws errors::BAD_JSON if the string is not in the expected format or a field has escape sequences.
+ */
+void
+Detail_view::decode(std::string_view str) {
+    Decode_error error;
+    if (!Detail_schema::find(str.data(), str.data() + str.size(), *this, error, nullptr)) {
+        throw BAD_JSON;
+    }
+}
+
+/**
+ * @brief Decodes a JSON-like string, unescaping fields with escape sequences into a buffer.
+ * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+ * @param buffer Cleared and then receives the unescaped fields; other fields are not copied.
  * @throws errors::BAD_JSON if the string is not in the expected format.
  */
 void
-Detail_info::decode(const string& str) {
-    std::regex pattern(
-        R"(\s*\{\s*'id'\s*:\s*'([^']*)'\s*,\s*'name'\s*:\s*'([^']*)'\s*,\s*'count'\s*:\s*(\d+)\s*\}\s*)");
-    std::smatch matches;
-    if (std::regex_search(str, matches, pattern)) {
-        string id = matches[1];
-        string name = matches[2];
-        std::size_t count = stoi(matches[3]);
-        this->init(id, name, count);
-    } else {
+Detail_view::decode(std::string_view str, string& buffer) {
+    Decode_error error;
+    if (!Detail_schema::find(str.data(), str.data() + str.size(), *this, error, &buffer)) {
         throw BAD_JSON;
     }
 }
 
+/**
+ * @brief Decodes a JSON-like string into a new detail without throwing on malformed input.
+ * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+ * @return The decoded detail, or the position and reason of the failure.
+ */
+std::expected<Detail_info, Decode_error>
+Detail_info::try_decode(std::string_view str) {
+    string buffer;
+    std::expected<Detail_view, Decode_error> view = Detail_view::try_decode(str, buffer);
+    if (!view) {
+        return std::unexpected(view.error());
+    }
+    return Detail_info(*view);
+}
+
+/**
+ * @brief Decodes a string view and extracts the detail information.
+ * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+ * @throws errors::BAD_JSON if the string is not in the expected format.
+ */
+void
+Detail_info::decode(std::string_view str) {
+    Detail_view view;
+    string buffer;
+    view.decode(str, buffer);
+    this->id.assign(view.id);
+    this->name.assign(view.name);
+    this->count = view.count;
+}
+
+/**
+ * @brief Decodes a JSON-like string and extracts the detail information.
+ * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+ * @throws errors::BAD_JSON if the string is not in the expected format.
+ */
+void
+Detail_info::decode(const string& str) {
+    return this->decode(std::string_view(str));
+}
+
 /**
  * @brief Decodes a C-style string and extracts the detail information.
  * @param str A C-style string containing the detail information.
  */
 void
 Detail_info::decode(const char* str) {
-    return this->decode(string(str));
+    return this->decode(std::string_view(str));
 }
 
 /**
@@ -84,7 +404,7 @@ Detail_info::decode(const char* str) {
  */
 void
 Detail_info::decode(const char* str, std::size_t size) {
-    return this->decode(string(str, size));
+    return this->decode(std::string_view(str, size));
 }
 
 /**
@@ -111,6 +431,16 @@ Detail_info::Detail_info(const string& id, const string& name, std::size_t count
  */
 Detail_info::Detail_info(const string& str) { this->decode(str); }
 
+/**
+ * @brief Constructs a Detail_info object by copying the fields of a view.
+ * @param view A decoded view of the detail.
+ */
+Detail_info::Detail_info(const Detail_view& view) {
+    this->id.assign(view.id);
+    this->name.assign(view.name);
+    this->count = view.count;
+}
+
 /**
  * @brief Default constructor for Detail_info. Initializes with empty values.
  */
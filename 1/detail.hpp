@@ -6,16 +6,119 @@
 #ifndef LAB1_DETAIL_HPP
 #define LAB1_DETAIL_HPP
 
+#include <expected>
 #include <string>
+#include <string_view>
+#include <vector>
+#include "schema.hpp"
+
+using std::string;
 
 /**
- * @brief Error codes for Detail_info.
+ * @struct Detail_view
+ * @brief Non-owning result of decoding; id and name point into the decoded buffer.
+ *
+ * The fields always hold the unescaped values. A field without escape sequences points into the
+ * decoded string; one with escape sequences is unescaped into a caller-owned buffer. The view stays
+ * valid only as long as both of them.
  */
-typedef enum _errors {
-    BAD_JSON ///< Error thrown when decoding a malformed JSON string.
-} errors;
+struct Detail_view {
+    std::string_view id;   ///< ID of the detail.
+    std::string_view name; ///< Name of the detail.
+    std::size_t count = 0; ///< Count of the detail.
 
-using std::string;
+    /**
+     * @brief Decodes a JSON-like string without copying the fields.
+     * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+     * @throws errors::BAD_JSON if the string is not in the expected format or a field has escape sequences.
+     */
+    void decode(std::string_view str);
+
+    /**
+     * @brief Decodes a JSON-like string, unescaping fields with escape sequences into a buffer.
+     * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+     * @param buffer Cleared and then receives the unescaped fields; other fields are not copied.
+     * @throws errors::BAD_JSON if the string is not in the expected format.
+     */
+    void decode(std::string_view str, string& buffer);
+
+    /**
+     * @brief Decodes a JSON-like string without copying the fields and without throwing.
+     * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+     * @return The decoded view, or the position and reason of the failure.
+     */
+    static std::expected<Detail_view, Decode_error> try_decode(std::string_view str) noexcept;
+
+    /**
+     * @brief Decodes a JSON-like string without throwing, unescaping fields with escape sequences into a buffer.
+     * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+     * @param buffer Cleared and then receives the unescaped fields; other fields are not copied.
+     * @return The decoded view, or the position and reason of the failure.
+     */
+    static std::expected<Detail_view, Decode_error> try_decode(std::string_view str, string& buffer);
+
+    /**
+     * @brief Appends the encoded detail to a caller-owned string.
+     * @param out The string to append to; no other memory is allocated.
+     */
+    void encode_to(string& out) const;
+
+    /**
+     * @brief Writes the encoded detail to an output iterator.
+     * @tparam OutputIt An output iterator accepting char.
+     * @param out The iterator to write to.
+     * @return The iterator past the last written character.
+     */
+    template <typename OutputIt>
+    OutputIt encode_to(OutputIt out) const;
+
+    /**
+     * @brief Returns the length of the encoded detail.
+     * @return The number of characters written by encode_to().
+     */
+    std::size_t encoded_size() const;
+
+    /**
+     * @brief Appends the detail in the binary format to a caller-owned string.
+     *
+     * The binary format is the varint length and bytes of id, the varint length and bytes of name,
+     * and the varint count, where a varint stores 7 bits per byte starting with the lowest.
+     *
+     * @param out The string to append to.
+     */
+    void encode_binary(string& out) const;
+
+    /**
+     * @brief Decodes one detail in the binary format without copying the fields.
+     * @param data Binary data starting with the detail; trailing bytes are ignored.
+     * @return The number of bytes consumed.
+     * @throws errors::BAD_BINARY if the data is truncated or malformed.
+     */
+    std::size_t decode_binary(std::string_view data);
+};
+
+/**
+ * @brief Schema of the JSON-like format: the keys of a detail record in order and the members they map to.
+ */
+using Detail_schema = Schema<Field<"id", &Detail_view::id>, Field<"name", &Detail_view::name>,
+                             Field<"count", &Detail_view::count>>;
+
+/**
+ * @brief Converts the first JSON-like record in a string to the binary format.
+ * @param text A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+ * @param out The string the binary record is appended to.
+ * @throws errors::BAD_JSON if the string is not in the expected format.
+ */
+void text_to_binary(std::string_view text, string& out);
+
+/**
+ * @brief Converts one binary record to the JSON-like format.
+ * @param data Binary data starting with the record.
+ * @param out The string the JSON-like record is appended to.
+ * @return The number of bytes consumed from data.
+ * @throws errors::BAD_BINARY if the data is truncated or malformed.
+ */
+std::size_t binary_to_text(std::string_view data, string& out);
 
 /**
  * @class Detail_info
@@ -51,6 +154,71 @@ class Detail_info {
      */
     string encode(const string& id, const string& name, std::size_t count);
 
+    /**
+     * @brief Appends the encoded detail to a caller-owned string.
+     * @param out The string to append to; no other memory is allocated.
+     */
+    void encode_to(string& out) const;
+
+    /**
+     * @brief Appends the encoded detail to a caller-owned character vector.
+     * @param out The vector to append to; no other memory is allocated.
+     */
+    void encode_to(std::vector<char>& out) const;
+
+    /**
+     * @brief Writes the encoded detail to an output iterator.
+     * @tparam OutputIt An output iterator accepting char.
+     * @param out The iterator to write to.
+     * @return The iterator past the last written character.
+     */
+    template <typename OutputIt>
+    OutputIt encode_to(OutputIt out) const;
+
+    /**
+     * @brief Returns the length of the encoded detail.
+     * @return The number of characters written by encode_to().
+     */
+    std::size_t encoded_size() const;
+
+    /**
+     * @brief Appends the detail in the binary format to a caller-owned string.
+     * @param out The string to append to.
+     */
+    void encode_binary(string& out) const;
+
+    /**
+     * @brief Decodes one detail in the binary format.
+     * @param data Binary data starting with the detail; trailing bytes are ignored.
+     * @return The number of bytes consumed.
+     * @throws errors::BAD_BINARY if the data is truncated or malformed.
+     */
+    std::size_t decode_binary(std::string_view data);
+
+    /**
+     * @brief Returns a view of the fields, valid while the detail is alive and unchanged.
+     * @return A Detail_view of the detail.
+     */
+    Detail_view view() const;
+
+    /**
+     * @brief Returns the ID of the detail.
+     * @return The ID of the detail.
+     */
+    const string& get_id() const;
+
+    /**
+     * @brief Returns the name of the detail.
+     * @return The name of the detail.
+     */
+    const string& get_name() const;
+
+    /**
+     * @brief Returns the count of the detail.
+     * @return The count of the detail.
+     */
+    std::size_t get_count() const;
+
     /**
      * @brief Decodes a JSON-like string and extracts the detail information.
      * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
@@ -58,6 +226,20 @@ class Detail_info {
      */
     void decode(const string& str);
 
+    /**
+     * @brief Decodes a JSON-like string into a new detail without throwing on malformed input.
+     * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+     * @return The decoded detail, or the position and reason of the failure.
+     */
+    static std::expected<Detail_info, Decode_error> try_decode(std::string_view str);
+
+    /**
+     * @brief Decodes a string view and extracts the detail information.
+     * @param str A string in the format {'id':'<id>', 'name':'<name>', 'count':<count>}.
+     * @throws errors::BAD_JSON if the string is not in the expected format.
+     */
+    void decode(std::string_view str);
+
     /**
      * @brief Decodes a C-style string and extracts the detail information.
      * @param str A C-style string containing the detail information.
@@ -90,10 +272,40 @@ class Detail_info {
      */
     Detail_info(const string& str);
 
+    /**
+     * @brief Constructs a Detail_info object by copying the fields of a view.
+     * @param view A decoded view of the detail.
+     */
+    Detail_info(const Detail_view& view);
+
     /**
      * @brief Default constructor for Detail_info. Initializes with empty values.
      */
     Detail_info();
 };
 
+/**
+ * @brief Writes the encoded detail to an output iterator.
+ * @tparam OutputIt An output iterator accepting char.
+ * @param out The iterator to write to.
+ * @return The iterator past the last written character.
+ */
+template <typename OutputIt>
+OutputIt
+Detail_view::encode_to(OutputIt out) const {
+    return Detail_schema::encode_to(*this, out);
+}
+
+/**
+ * @brief Writes the encoded detail to an output iterator.
+ * @tparam OutputIt An output iterator accepting char.
+ * @param out The iterator to write to.
+ * @return The iterator past the last written character.
+ */
+template <typename OutputIt>
+OutputIt
+Detail_info::encode_to(OutputIt out) const {
+    return this->view().encode_to(out);
+}
+
 #endif // LAB1_DETAIL_HPP
@@ -0,0 +1,286 @@
+/**
+ * @file detail_decoder.cpp
+ * @brief Implementation of the Detail_decoder class.
+ */
+
+#include "detail_decoder.hpp"
+#include <iterator>
+#include <limits>
+#include "scan.hpp"
+
+namespace {
+
+/**
+ * @brief Kind of a step of the record grammar.
+ */
+enum class Kind { LITERAL, QUOTED, NUMBER };
+
+/**
+ * @brief Step of the record grammar.
+ */
+struct Step {
+    Kind kind;             ///< What the step consumes.
+    std::string_view text; ///< Literal to match for LITERAL steps.
+    std::size_t field;     ///< Field the payload belongs to for QUOTED steps: 0 for the id, 1 for the name.
+};
+
+/**
+ * @brief Record grammar, the same sequence of tokens the one-shot decoder matches.
+ *
+ * Whitespace is allowed before every step except the opening brace.
+ */
+constexpr Step grammar[] = {
+    {Kind::LITERAL, "{", 0},       {Kind::LITERAL, "'id'", 0}, {Kind::LITERAL, ":", 0},
+    {Kind::QUOTED, "", 0},         {Kind::LITERAL, ",", 0},    {Kind::LITERAL, "'name'", 0},
+    {Kind::LITERAL, ":", 0},       {Kind::QUOTED, "", 1},      {Kind::LITERAL, ",", 0},
+    {Kind::LITERAL, "'count'", 0}, {Kind::LITERAL, ":", 0},    {Kind::NUMBER, "", 0},
+    {Kind::LITERAL, "}", 0},
+};
+
+} // namespace
+
+/**
+ * @brief Advances the parser by one character of the current candidate.
+ *
+ * The character must already be appended to pending.
+ *
+ * @param c The next character.
+ * @return Whether the candidate needs more input, is complete or is malformed.
+ */
+Detail_decoder::Status
+Detail_decoder::advance(char c) {
+    const Step& current = grammar[this->step];
+    switch (current.kind) {
+    case Kind::LITERAL:
+        if (this->offset == 0 && is_space(c)) {
+            return Status::MORE;
+        }
+        if (c != current.text[this->offset]) {
+            return Status::FAILED;
+        }
+        if (++this->offset < current.text.size()) {
+            return Status::MORE;
+        }
+        break;
+    case Kind::QUOTED:
+        if (this->offset == 0) {
+            if (is_space(c)) {
+                return Status::MORE;
+            }
+            if (c != '\'') {
+                return Status::FAILED;
+            }
+            this->offset = 1;
+            this->fields[current.field][0] = this->pending.size();
+            this->escaped[current.field] = false;
+            this->ascii = true;
+            return Status::MORE;
+        }
+        if (this->offset == 2) {
+            // The character after a backslash.
+            if (unescape_char(c) == '\0') {
+                return Status::FAILED;
+            }
+            this->offset = 1;
+            return Status::MORE;
+        }
+        if (c == '\\') {
+            this->offset = 2;
+            this->escaped[current.field] = true;
+            return Status::MORE;
+        }
+        if (c != '\'') {
+            if (c & 0x80) {
+                this->ascii = false;
+            }
+            return Status::MORE;
+        }
+        this->fields[current.field][1] = this->pending.size() - 1;
+        if (!this->ascii) {
+            const char* first = this->pending.data() + this->fields[current.field][0];
+            const char* last = this->pending.data() + this->fields[current.field][1];
+            if (find_invalid_utf8(first, last) != last) {
+                return Status::FAILED;
+            }
+        }
+        break;
+    case Kind::NUMBER:
+        if (c >= '0' && c <= '9') {
+            std::size_t digit = c - '0';
+            if (this->count > (std::numeric_limits<std::size_t>::max() - digit) / 10) {
+                return Status::FAILED;
+            }
+            this->count = this->count * 10 + digit;
+            ++this->offset;
+            return Status::MORE;
+        }
+        if (this->offset == 0) {
+            return is_space(c) ? Status::MORE : Status::FAILED;
+        }
+        // The character after the digits belongs to the next step.
+        ++this->step;
+        this->offset = 0;
+        return this->advance(c);
+    }
+    this->offset = 0;
+    return ++this->step == std::size(grammar) ? Status::DONE : Status::MORE;
+}
+
+/**
+ * @brief Feeds one character of the stream to the parser.
+ * @param c The next character.
+ * @return Whether the current candidate needs more input, is complete or is malformed.
+ */
+Detail_decoder::Status
+Detail_decoder::consume(char c) {
+    if (this->step == 0) {
+        if (c == '{') {
+            this->pending.assign(1, c);
+            this->step = 1;
+        }
+        return Status::MORE;
+    }
+    this->pending.push_back(c);
+    return this->advance(c);
+}
+
+/**
+ * @brief Passes the completed record to the callback and starts looking for the next one.
+ *
+ * Payloads without escape sequences are passed in place; the others are unescaped into the buffer,
+ * which is reserved up front so that the first field stays valid while the second is written.
+ *
+ * @param on_record Called with the completed record.
+ */
+void
+Detail_decoder::emit(const std::function<void(const Detail_view&)>& on_record) {
+    std::string_view values[2];
+    this->buffer.clear();
+    this->buffer.reserve(this->pending.size());
+    for (std::size_t field = 0; field < 2; ++field) {
+        std::string_view raw(this->pending.data() + this->fields[field][0],
+                             this->fields[field][1] - this->fields[field][0]);
+        if (!this->escaped[field]) {
+            values[field] = raw;
+            continue;
+        }
+        std::size_t start = this->buffer.size();
+        for (std::size_t i = 0; i < raw.size(); ++i) {
+            this->buffer.push_back(raw[i] == '\\' ? unescape_char(raw[++i]) : raw[i]);
+        }
+        values[field] = std::string_view(this->buffer.data() + start, this->buffer.size() - start);
+    }
+    on_record(Detail_view{values[0], values[1], this->count});
+    this->reset();
+}
+
+/**
+ * @brief Replays a malformed candidate from the character after its opening brace.
+ *
+ * A record nested in a malformed prefix is therefore still found. Well-formed input never gets here,
+ * and the replay buffer is kept in one place so that nested failures do not recurse.
+ *
+ * @param on_record Called for every record completed by the replayed characters.
+ * @return The number of completed records.
+ */
+std::size_t
+Detail_decoder::rescan(const std::function<void(const Detail_view&)>& on_record) {
+    std::size_t records = 0;
+    std::string replay = this->pending.substr(1);
+    this->reset();
+    for (std::size_t next = 0; next < replay.size();) {
+        Status status = this->consume(replay[next++]);
+        if (status == Status::DONE) {
+            this->emit(on_record);
+            ++records;
+        } else if (status == Status::FAILED) {
+            replay = this->pending.substr(1) + replay.substr(next);
+            next = 0;
+            this->reset();
+        }
+    }
+    return records;
+}
+
+/**
+ * @brief Decodes the next chunk of the stream.
+ *
+ * The search for an opening brace and the runs of plain payload characters are scanned at once, and
+ * literals that lie entirely in the chunk are matched at once. Everything else, including input split
+ * in the middle of a token, goes through the parser one character at a time.
+ *
+ * @param chunk The next bytes of the stream.
+ * @param on_record Called for every completed record; the view is valid only during the call.
+ * @return The number of records completed by this chunk.
+ */
+std::size_t
+Detail_decoder::feed(std::string_view chunk, const std::function<void(const Detail_view&)>& on_record) {
+    std::size_t records = 0;
+    const char* it = chunk.data();
+    const char* end = it + chunk.size();
+    while (it != end) {
+        if (this->step == 0) {
+            it = find_char(it, end, '{');
+            if (it == end) {
+                break;
+            }
+        } else if (grammar[this->step].kind == Kind::QUOTED && this->offset == 1) {
+            const char* quote = find_quote_or_escape(it, end, this->ascii);
+            this->pending.append(it, quote);
+            it = quote;
+            if (it == end) {
+                break;
+            }
+        } else if (grammar[this->step].kind == Kind::LITERAL && this->offset == 0) {
+            std::string_view literal = grammar[this->step].text;
+            if (static_cast<std::size_t>(end - it) >= literal.size() && std::string_view(it, literal.size()) == literal) {
+                this->pending.append(literal);
+                it += literal.size();
+                if (++this->step == std::size(grammar)) {
+                    this->emit(on_record);
+                    ++records;
+                }
+                continue;
+            }
+        }
+        Status status = this->consume(*it++);
+        if (status == Status::DONE) {
+            this->emit(on_record);
+            ++records;
+        } else if (status == Status::FAILED) {
+            records += this->rescan(on_record);
+        }
+    }
+    return records;
+}
+
+/**
+ * @brief Decodes the next chunk of the stream.
+ * @param chunk The next bytes of the stream.
+ * @param details Receives every completed record.
+ * @return The number of records completed by this chunk.
+ */
+std::size_t
+Detail_decoder::feed(std::string_view chunk, std::vector<Detail_info>& details) {
+    return this->feed(chunk, [&details](const Detail_view& view) { details.emplace_back(view); });
+}
+
+/**
+ * @brief Returns the number of bytes held for a record that is not complete yet.
+ * @return Zero if the decoder is between records.
+ */
+std::size_t
+Detail_decoder::pending_size() const {
+    return this->pending.size();
+}
+
+/**
+ * @brief Discards the incomplete record, if any.
+ */
+void
+Detail_decoder::reset() {
+    this->pending.clear();
+    this->step = 0;
+    this->offset = 0;
+    this->count = 0;
+}
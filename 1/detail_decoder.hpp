@@ -0,0 +1,98 @@
+/**
+ * @file detail_decoder.hpp
+ * @brief Header file for the Detail_decoder class that decodes records arriving in fragments.
+ */
+
+#ifndef LAB1_DETAIL_DECODER_HPP
+#define LAB1_DETAIL_DECODER_HPP
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "detail.hpp"
+
+/**
+ * @class Detail_decoder
+ * @brief Push-style decoder for a stream of encoded records split into arbitrary chunks.
+ *
+ * The parser state is kept between calls to feed(), so every byte of a well-formed record is
+ * examined once no matter where the chunks are split, and a record is emitted as soon as its
+ * closing brace arrives. Escape sequences and UTF-8 are checked with the same rules as
+ * Detail_info::decode(). Text between records is skipped the same way Detail_info::decode()
+ * skips text around a record: when a candidate turns out to be malformed, the search resumes
+ * right after its opening brace.
+ */
+class Detail_decoder {
+  private:
+    std::string pending;           ///< Bytes of the current candidate, starting with its opening brace.
+    std::string buffer;            ///< Unescaped fields of the emitted record.
+    std::size_t step = 0;          ///< Position in the record grammar; zero while looking for a brace.
+    std::size_t offset = 0;        ///< Progress within the current step.
+    std::size_t count = 0;         ///< Value of the count field read so far.
+    std::size_t fields[2][2] = {}; ///< Begin and end of the raw id and name payloads in pending.
+    bool escaped[2] = {};          ///< Whether the id and name payloads hold escape sequences.
+    bool ascii = true;             ///< Whether the current payload holds only ASCII characters so far.
+
+    /**
+     * @brief Result of advancing the parser by one character.
+     */
+    enum class Status { MORE, DONE, FAILED };
+
+    /**
+     * @brief Advances the parser by one character of the current candidate.
+     * @param c The next character.
+     * @return Whether the candidate needs more input, is complete or is malformed.
+     */
+    Status advance(char c);
+
+    /**
+     * @brief Feeds one character of the stream to the parser.
+     * @param c The next character.
+     * @return Whether the current candidate needs more input, is complete or is malformed.
+     */
+    Status consume(char c);
+
+    /**
+     * @brief Passes the completed record to the callback and starts looking for the next one.
+     * @param on_record Called with the completed record.
+     */
+    void emit(const std::function<void(const Detail_view&)>& on_record);
+
+    /**
+     * @brief Replays a malformed candidate from the character after its opening brace.
+     * @param on_record Called for every record completed by the replayed characters.
+     * @return The number of completed records.
+     */
+    std::size_t rescan(const std::function<void(const Detail_view&)>& on_record);
+
+  public:
+    /**
+     * @brief Decodes the next chunk of the stream.
+     * @param chunk The next bytes of the stream.
+     * @param on_record Called for every completed record; the view is valid only during the call.
+     * @return The number of records completed by this chunk.
+     */
+    std::size_t feed(std::string_view chunk, const std::function<void(const Detail_view&)>& on_record);
+
+    /**
+     * @brief Decodes the next chunk of the stream.
+     * @param chunk The next bytes of the stream.
+     * @param details Receives every completed record.
+     * @return The number of records completed by this chunk.
+     */
+    std::size_t feed(std::string_view chunk, std::vector<Detail_info>& details);
+
+    /**
+     * @brief Returns the number of bytes held for a record that is not complete yet.
+     * @return Zero if the decoder is between records.
+     */
+    std::size_t pending_size() const;
+
+    /**
+     * @brief Discards the incomplete record, if any.
+     */
+    void reset();
+};
+
+#endif // LAB1_DETAIL_DECODER_HPP
@@ -0,0 +1,116 @@
+/**
+ * @file detail_index.cpp
+ * @brief Implementation of the Detail_index class.
+ */
+
+#include "detail_index.hpp"
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+/**
+ * @brief Builds the hash index over a batch of details.
+ *
+ * The table has at least twice as many slots as details, so probe sequences stay short.
+ *
+ * @param details The batch to index.
+ * @param with_sorted Also build the sorted index.
+ * @throws std::length_error if the batch holds 2^32 - 1 or more details.
+ */
+Detail_index::Detail_index(const std::vector<Detail_info>& details, bool with_sorted) : details(details) {
+    if (details.size() >= std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("Too many details to index");
+    }
+    this->slots.assign(std::bit_ceil(std::max<std::size_t>(details.size() * 2, 16)), Slot{0, 0});
+    std::size_t mask = this->slots.size() - 1;
+    for (std::uint32_t position = 0; position < details.size(); ++position) {
+        std::string_view id = details[position].get_id();
+        std::size_t hash = std::hash<std::string_view>{}(id);
+        std::uint32_t tag = hash >> 32;
+        std::size_t slot = hash & mask;
+        while (this->slots[slot].position != 0
+               && (this->slots[slot].tag != tag || details[this->slots[slot].position - 1].get_id() != id)) {
+            slot = (slot + 1) & mask;
+        }
+        if (this->slots[slot].position == 0) {
+            this->slots[slot] = Slot{tag, position + 1};
+        }
+    }
+    if (with_sorted) {
+        this->build_sorted();
+    }
+}
+
+/**
+ * @brief Builds the sorted index used by prefix() and range().
+ */
+void
+Detail_index::build_sorted() {
+    this->sorted.resize(this->details.size());
+    std::iota(this->sorted.begin(), this->sorted.end(), 0);
+    std::stable_sort(this->sorted.begin(), this->sorted.end(), [this](std::uint32_t a, std::uint32_t b) {
+        return this->details[a].get_id() < this->details[b].get_id();
+    });
+}
+
+/**
+ * @brief Finds the first detail with the given id.
+ * @param id The id to look for.
+ * @return Pointer to the detail in the batch, or nullptr if there is none.
+ */
+const Detail_info*
+Detail_index::find(std::string_view id) const {
+    std::size_t hash = std::hash<std::string_view>{}(id);
+    std::uint32_t tag = hash >> 32;
+    std::size_t mask = this->slots.size() - 1;
+    for (std::size_t slot = hash & mask; this->slots[slot].position != 0; slot = (slot + 1) & mask) {
+        const Slot& entry = this->slots[slot];
+        if (entry.tag == tag && this->details[entry.position - 1].get_id() == id) {
+            return &this->details[entry.position - 1];
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Finds all details whose id starts with the given prefix.
+ * @param prefix The prefix to look for.
+ * @return Positions of the details in the batch, ordered by id.
+ * @throws std::logic_error if the sorted index was not built.
+ */
+std::span<const std::uint32_t>
+Detail_index::prefix(std::string_view prefix) const {
+    if (this->sorted.size() != this->details.size()) {
+        throw std::logic_error("Sorted index is not built");
+    }
+    auto first = std::partition_point(this->sorted.begin(), this->sorted.end(), [this, prefix](std::uint32_t p) {
+        return std::string_view(this->details[p].get_id()) < prefix;
+    });
+    auto last = std::partition_point(first, this->sorted.end(), [this, prefix](std::uint32_t p) {
+        return std::string_view(this->details[p].get_id()).starts_with(prefix);
+    });
+    return std::span<const std::uint32_t>(first, last);
+}
+
+/**
+ * @brief Finds all details whose id lies in [first, last).
+ * @param first The smallest id to include.
+ * @param last The smallest id to exclude.
+ * @return Positions of the details in the batch, ordered by id.
+ * @throws std::logic_error if the sorted index was not built.
+ */
+std::span<const std::uint32_t>
+Detail_index::range(std::string_view first, std::string_view last) const {
+    if (this->sorted.size() != this->details.size()) {
+        throw std::logic_error("Sorted index is not built");
+    }
+    auto below = [this](std::string_view bound) {
+        return [this, bound](std::uint32_t p) { return std::string_view(this->details[p].get_id()) < bound; };
+    };
+    auto begin = std::partition_point(this->sorted.begin(), this->sorted.end(), below(first));
+    auto end = std::partition_point(begin, this->sorted.end(), below(std::max(first, last)));
+    return std::span<const std::uint32_t>(begin, end);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file detail_index.hpp
+ * @brief Header file for the Detail_index class that indexes decoded details by id.
+ */
+
+#ifndef LAB1_DETAIL_INDEX_HPP
+#define LAB1_DETAIL_INDEX_HPP
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+#include "detail.hpp"
+
+/**
+ * @class Detail_index
+ * @brief Index over a batch of decoded details by id.
+ *
+ * Point lookups go through an open-addressing hash table with linear probing. An optional sorted
+ * index answers prefix and range queries. The index refers to the batch by position, so the batch
+ * must outlive the index and must not change while it is used.
+ */
+class Detail_index {
+  private:
+    /**
+     * @brief Slot of the hash table.
+     */
+    struct Slot {
+        std::uint32_t tag;      ///< Upper bits of the hash of the id.
+        std::uint32_t position; ///< Position of the detail + 1; zero marks an empty slot.
+    };
+
+    const std::vector<Detail_info>& details; ///< Indexed batch.
+    std::vector<Slot> slots;                 ///< Hash table.
+    std::vector<std::uint32_t> sorted;       ///< Positions sorted by id; empty until build_sorted().
+
+  public:
+    /**
+     * @brief Builds the hash index over a batch of details.
+     * @param details The batch to index.
+     * @param with_sorted Also build the sorted index.
+     * @throws std::length_error if the batch holds 2^32 - 1 or more details.
+     */
+    Detail_index(const std::vector<Detail_info>& details, bool with_sorted = false);
+
+    /**
+     * @brief Deleted, because the index would refer to a temporary batch.
+     */
+    Detail_index(const std::vector<Detail_info>&&, bool = false) = delete;
+
+    /**
+     * @brief Builds the sorted index used by prefix() and range().
+     */
+    void build_sorted();
+
+    /**
+     * @brief Finds the first detail with the given id.
+     * @param id The id to look for.
+     * @return Pointer to the detail in the batch, or nullptr if there is none.
+     */
+    const Detail_info* find(std::string_view id) const;
+
+    /**
+     * @brief Finds all details whose id starts with the given prefix.
+     * @param prefix The prefix to look for.
+     * @return Positions of the details in the batch, ordered by id.
+     * @throws std::logic_error if the sorted index was not built.
+     */
+    std::span<const std::uint32_t> prefix(std::string_view prefix) const;
+
+    /**
+     * @brief Finds all details whose id lies in [first, last).
+     * @param first The smallest id to include.
+     * @param last The smallest id to exclude.
+     * @return Positions of the details in the batch, ordered by id.
+     * @throws std::logic_error if the sorted index was not built.
+     */
+    std::span<const std::uint32_t> range(std::string_view first, std::string_view last) const;
+};
+
+#endif // LAB1_DETAIL_INDEX_HPP
@@ -0,0 +1,110 @@
+/**
+ * @file detail_reader.cpp
+ * @brief Implementation of the Detail_reader class.
+ */
+
+#include "detail_reader.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Decodes every line of a buffer with one encoded record per line.
+ *
+ * Lines go through Detail_view::try_decode(), so malformed input costs no exception unwinding.
+ *
+ * @param data The buffer to decode.
+ * @param line Number of lines seen so far; advanced by the number of lines in data.
+ * @param on_record Called for every decoded record; the view is valid only during the call.
+ * @param on_error Called with the 1-based line number of every malformed line.
+ * @return The number of decoded records.
+ */
+std::size_t
+decode_lines(std::string_view data, std::size_t& line, const std::function<void(const Detail_view&)>& on_record,
+             const std::function<void(std::size_t)>& on_error) {
+    std::size_t decoded = 0;
+    string buffer;
+    while (!data.empty()) {
+        const char* newline = static_cast<const char*>(std::memchr(data.data(), '\n', data.size()));
+        std::size_t length = newline != nullptr ? newline - data.data() : data.size();
+        std::string_view str = data.substr(0, length);
+        data.remove_prefix(newline != nullptr ? length + 1 : length);
+        ++line;
+        if (str.empty()) {
+            continue;
+        }
+        std::expected<Detail_view, Decode_error> view = Detail_view::try_decode(str, buffer);
+        if (!view) {
+            on_error(line);
+            continue;
+        }
+        on_record(*view);
+        ++decoded;
+    }
+    return decoded;
+}
+
+/**
+ * @brief Constructs a reader over the given stream.
+ * @param in The stream to read records from.
+ * @param chunk_size Initial size of the chunk buffer in bytes.
+ * @throws std::invalid_argument if chunk_size is zero.
+ */
+Detail_reader::Detail_reader(std::istream& in, std::size_t chunk_size) : in(in) {
+    if (chunk_size == 0) {
+        throw std::invalid_argument("Invalid argument");
+    }
+    this->buffer.resize(chunk_size);
+}
+
+/**
+ * @brief Decodes all remaining lines of the stream.
+ *
+ * Complete lines are decoded straight from the chunk buffer. The unfinished tail of a chunk is moved
+ * to the front of the buffer before the next read, and the buffer grows only when a single line
+ * does not fit into it.
+ *
+ * @param on_record Called for every decoded record; the view is valid only during the call.
+ * @param on_error Called with the 1-based line number of every malformed line.
+ * @return The number of decoded records.
+ * @throws std::runtime_error if reading from the stream fails.
+ */
+std::size_t
+Detail_reader::read(const std::function<void(const Detail_view&)>& on_record,
+                    const std::function<void(std::size_t)>& on_error) {
+    std::size_t decoded = 0, line = 0, end = 0;
+    while (true) {
+        this->in.read(this->buffer.data() + end, this->buffer.size() - end);
+        end += this->in.gcount();
+        if (this->in.bad()) {
+            throw std::runtime_error(std::string("Failed to read stream: ") + strerror(errno));
+        }
+        std::string_view data(this->buffer.data(), end);
+        if (!this->in) {
+            return decoded + decode_lines(data, line, on_record, on_error);
+        }
+        std::size_t complete = data.rfind('\n') + 1;
+        decoded += decode_lines(data.substr(0, complete), line, on_record, on_error);
+        std::copy(this->buffer.begin() + complete, this->buffer.begin() + end, this->buffer.begin());
+        end -= complete;
+        if (end == this->buffer.size()) {
+            this->buffer.resize(this->buffer.size() * 2);
+        }
+    }
+}
+
+/**
+ * @brief Decodes all remaining lines of the stream and appends the records to a vector.
+ * @param details Receives the decoded records; reserve its capacity beforehand to avoid reallocations.
+ * @param bad_lines Receives the 1-based line numbers of malformed lines.
+ * @return The number of decoded records.
+ * @throws std::runtime_error if reading from the stream fails.
+ */
+std::size_t
+Detail_reader::read(std::vector<Detail_info>& details, std::vector<std::size_t>& bad_lines) {
+    return this->read([&details](const Detail_view& view) { details.emplace_back(view); },
+                      [&bad_lines](std::size_t line) { bad_lines.push_back(line); });
+}
@@ -0,0 +1,71 @@
+/**
+ * @file detail_reader.hpp
+ * @brief Header file for the Detail_reader class that decodes newline-delimited records.
+ */
+
+#ifndef LAB1_DETAIL_READER_HPP
+#define LAB1_DETAIL_READER_HPP
+
+#include <functional>
+#include <istream>
+#include <string_view>
+#include <vector>
+#include "detail.hpp"
+
+/**
+ * @brief Decodes every line of a buffer with one encoded record per line.
+ *
+ * A trailing newline does not start another line. Empty lines are skipped but counted.
+ *
+ * @param data The buffer to decode.
+ * @param line Number of lines seen so far; advanced by the number of lines in data.
+ * @param on_record Called for every decoded record; the view is valid only during the call.
+ * @param on_error Called with the 1-based line number of every malformed line.
+ * @return The number of decoded records.
+ */
+std::size_t decode_lines(std::string_view data, std::size_t& line,
+                         const std::function<void(const Detail_view&)>& on_record,
+                         const std::function<void(std::size_t)>& on_error);
+
+/**
+ * @class Detail_reader
+ * @brief Streaming decoder for input with one encoded Detail_info record per line.
+ *
+ * The input is read in chunks into a reusable buffer. Malformed lines are reported by line number
+ * and do not stop the run. Empty lines are skipped.
+ */
+class Detail_reader {
+  private:
+    std::istream& in;         ///< Stream the records are read from.
+    std::vector<char> buffer; ///< Reusable chunk buffer.
+
+  public:
+    /**
+     * @brief Constructs a reader over the given stream.
+     * @param in The stream to read records from.
+     * @param chunk_size Initial size of the chunk buffer in bytes.
+     * @throws std::invalid_argument if chunk_size is zero.
+     */
+    Detail_reader(std::istream& in, std::size_t chunk_size = 1 << 16);
+
+    /**
+     * @brief Decodes all remaining lines of the stream.
+     * @param on_record Called for every decoded record; the view is valid only during the call.
+     * @param on_error Called with the 1-based line number of every malformed line.
+     * @return The number of decoded records.
+     * @throws std::runtime_error if reading from the stream fails.
+     */
+    std::size_t read(const std::function<void(const Detail_view&)>& on_record,
+                     const std::function<void(std::size_t)>& on_error);
+
+    /**
+     * @brief Decodes all remaining lines of the stream and appends the records to a vector.
+     * @param details Receives the decoded records; reserve its capacity beforehand to avoid reallocations.
+     * @param bad_lines Receives the 1-based line numbers of malformed lines.
+     * @return The number of decoded records.
+     * @throws std::runtime_error if reading from the stream fails.
+     */
+    std::size_t read(std::vector<Detail_info>& details, std::vector<std::size_t>& bad_lines);
+};
+
+#endif // LAB1_DETAIL_READER_HPP
@@ -0,0 +1,133 @@
+/**
+ * @file detail_store.cpp
+ * @brief Implementation of the Detail_store class.
+ */
+
+#include "detail_store.hpp"
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+/**
+ * @brief Makes room for one more element, growing the capacity geometrically.
+ * @param values The vector to grow.
+ */
+template <typename T>
+void
+reserve_one(std::vector<T>& values) {
+    if (values.size() == values.capacity()) {
+        values.reserve(values.size() * 2 + 1);
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Adds a detail to the store.
+ *
+ * Everything that can throw happens before the id is interned, so a failed add leaves at most an
+ * unused name in the pool and never an id without its first record.
+ *
+ * @param view The detail to add; its strings are copied into the pools.
+ * @throws std::length_error if the store already holds 2^32 - 1 records, ids or names.
+ */
+void
+Detail_store::add(const Detail_view& view) {
+    if (this->records.size() == std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("Detail store overflow");
+    }
+    reserve_one(this->records);
+    reserve_one(this->first_with);
+    std::uint32_t name = this->names.intern(view.name);
+    std::uint32_t id = this->ids.intern(view.id);
+    if (id == this->first_with.size()) {
+        this->first_with.push_back(this->records.size());
+    }
+    this->records.push_back(Record{id, name, view.count});
+}
+
+/**
+ * @brief Reserves space for the given number of records.
+ * @param count Number of records.
+ */
+void
+Detail_store::reserve(std::size_t count) {
+    this->records.reserve(count);
+}
+
+/**
+ * @brief Returns the detail at the given position.
+ * @param index Position in insertion order.
+ * @return A view of the detail.
+ * @throws std::out_of_range if the index is out of range.
+ */
+Detail_view
+Detail_store::operator[](std::size_t index) const {
+    if (index >= this->records.size()) {
+        throw std::out_of_range("Invalid index: " + std::to_string(index));
+    }
+    const Record& record = this->records[index];
+    return Detail_view{this->ids.get(record.id), this->names.get(record.name), record.count};
+}
+
+/**
+ * @brief Finds the first detail with the given id.
+ * @param id The id to look for.
+ * @return A view of the detail, or std::nullopt if there is none.
+ */
+std::optional<Detail_view>
+Detail_store::find(std::string_view id) const {
+    std::uint32_t index;
+    if (!this->ids.find(id, index)) {
+        return std::nullopt;
+    }
+    return (*this)[this->first_with[index]];
+}
+
+/**
+ * @brief Returns the number of details in the store.
+ * @return The number of details.
+ */
+std::size_t
+Detail_store::size() const {
+    return this->records.size();
+}
+
+/**
+ * @brief Returns the number of distinct names in the store.
+ * @return The number of names.
+ */
+std::size_t
+Detail_store::name_count() const {
+    return this->names.size();
+}
+
+/**
+ * @brief Returns the number of bytes allocated by the store.
+ * @return The allocated memory in bytes.
+ */
+std::size_t
+Detail_store::memory_usage() const {
+    return this->ids.memory_usage() + this->names.memory_usage() + this->records.capacity() * sizeof(Record)
+           + this->first_with.capacity() * sizeof(std::uint32_t);
+}
+
+/**
+ * @brief Returns an iterator to the first detail.
+ * @return The iterator.
+ */
+Detail_store::iterator
+Detail_store::begin() const {
+    return iterator(this, 0);
+}
+
+/**
+ * @brief Returns an iterator past the last detail.
+ * @return The iterator.
+ */
+Detail_store::iterator
+Detail_store::end() const {
+    return iterator(this, this->records.size());
+}
@@ -0,0 +1,141 @@
+/**
+ * @file detail_store.hpp
+ * @brief Header file for the Detail_store class that keeps details as indices into string pools.
+ */
+
+#ifndef LAB1_DETAIL_STORE_HPP
+#define LAB1_DETAIL_STORE_HPP
+
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <vector>
+#include "detail.hpp"
+#include "string_pool.hpp"
+
+/**
+ * @class Detail_store
+ * @brief Compact collection of details with interned id and name strings.
+ *
+ * Every record is a fixed-size struct of two pool indices and the count, so scanning the store
+ * touches 16 bytes per record instead of two std::string objects. Views returned by the store are
+ * invalidated by the next call to add().
+ */
+class Detail_store {
+  private:
+    /**
+     * @brief Fixed-size record referring to the pools.
+     */
+    struct Record {
+        std::uint32_t id;   ///< Index of the id in the id pool.
+        std::uint32_t name; ///< Index of the name in the name pool.
+        std::size_t count;  ///< Count of the detail.
+    };
+
+    String_pool ids;                       ///< Pool of ids.
+    String_pool names;                     ///< Pool of names.
+    std::vector<Record> records;           ///< Records in insertion order.
+    std::vector<std::uint32_t> first_with; ///< First record for every id in the id pool.
+
+  public:
+    /**
+     * @class iterator
+     * @brief Iterator over the records of the store yielding Detail_view values.
+     */
+    class iterator {
+      private:
+        const Detail_store* store = nullptr; ///< Store being iterated.
+        std::size_t index = 0;               ///< Index of the current record.
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Detail_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Detail_view;
+
+        iterator() = default;
+
+        /**
+         * @brief Constructs an iterator at the given record.
+         * @param store Store being iterated.
+         * @param index Index of the record.
+         */
+        iterator(const Detail_store* store, std::size_t index) : store(store), index(index) {}
+
+        Detail_view operator*() const { return (*this->store)[this->index]; }
+
+        iterator& operator++() {
+            ++this->index;
+            return *this;
+        }
+
+        iterator operator++(int) {
+            iterator tmp = *this;
+            ++this->index;
+            return tmp;
+        }
+
+        bool operator==(const iterator& other) const = default;
+    };
+
+    /**
+     * @brief Adds a detail to the store.
+     * @param view The detail to add; its strings are copied into the pools.
+     * @throws std::length_error if the store already holds 2^32 - 1 records, ids or names.
+     */
+    void add(const Detail_view& view);
+
+    /**
+     * @brief Reserves space for the given number of records.
+     * @param count Number of records.
+     */
+    void reserve(std::size_t count);
+
+    /**
+     * @brief Returns the detail at the given position.
+     * @param index Position in insertion order.
+     * @return A view of the detail.
+     * @throws std::out_of_range if the index is out of range.
+     */
+    Detail_view operator[](std::size_t index) const;
+
+    /**
+     * @brief Finds the first detail with the given id.
+     * @param id The id to look for.
+     * @return A view of the detail, or std::nullopt if there is none.
+     */
+    std::optional<Detail_view> find(std::string_view id) const;
+
+    /**
+     * @brief Returns the number of details in the store.
+     * @return The number of details.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the number of distinct names in the store.
+     * @return The number of names.
+     */
+    std::size_t name_count() const;
+
+    /**
+     * @brief Returns the number of bytes allocated by the store.
+     * @return The allocated memory in bytes.
+     */
+    std::size_t memory_usage() const;
+
+    /**
+     * @brief Returns an iterator to the first detail.
+     * @return The iterator.
+     */
+    iterator begin() const;
+
+    /**
+     * @brief Returns an iterator past the last detail.
+     * @return The iterator.
+     */
+    iterator end() const;
+};
+
+#endif // LAB1_DETAIL_STORE_HPP
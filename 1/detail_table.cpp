@@ -0,0 +1,178 @@
+/**
+ * @file detail_table.cpp
+ * @brief Implementation of the Detail_table class.
+ */
+
+#include "detail_table.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Constructs a table from decoded details.
+ * @param details The details to add.
+ */
+Detail_table::Detail_table(const std::vector<Detail_info>& details) {
+    this->reserve(details.size());
+    for (const Detail_info& detail : details) {
+        this->add(detail.view());
+    }
+}
+
+/**
+ * @brief Appends a row.
+ * @param view The detail to append; its strings are copied into the pools.
+ */
+void
+Detail_table::add(const Detail_view& view) {
+    this->id_codes.push_back(this->id_pool.intern(view.id));
+    this->name_codes.push_back(this->name_pool.intern(view.name));
+    this->counts.push_back(view.count);
+}
+
+/**
+ * @brief Reserves space for the given number of rows.
+ * @param rows Number of rows.
+ */
+void
+Detail_table::reserve(std::size_t rows) {
+    this->id_codes.reserve(rows);
+    this->name_codes.reserve(rows);
+    this->counts.reserve(rows);
+}
+
+/**
+ * @brief Returns the number of rows.
+ * @return The number of rows.
+ */
+std::size_t
+Detail_table::size() const {
+    return this->counts.size();
+}
+
+/**
+ * @brief Returns the row at the given position.
+ * @param index Position of the row.
+ * @return A view of the row, invalidated by the next call to add().
+ * @throws std::out_of_range if the index is out of range.
+ */
+Detail_view
+Detail_table::row(std::size_t index) const {
+    if (index >= this->size()) {
+        throw std::out_of_range("Invalid index: " + std::to_string(index));
+    }
+    return Detail_view{this->id_pool.get(this->id_codes[index]), this->name_pool.get(this->name_codes[index]),
+                       this->counts[index]};
+}
+
+/**
+ * @brief Returns the count column.
+ * @return The counts of all rows.
+ */
+const std::vector<std::size_t>&
+Detail_table::count_column() const {
+    return this->counts;
+}
+
+/**
+ * @brief Sums the counts of all rows.
+ * @return The sum.
+ */
+std::size_t
+Detail_table::sum() const {
+    std::size_t total = 0;
+    for (std::size_t count : this->counts) {
+        total += count;
+    }
+    return total;
+}
+
+/**
+ * @brief Sums the counts of the rows with the given name.
+ *
+ * The loop is branch-free: every count is masked by the result of the code comparison.
+ *
+ * @param name The name to filter by.
+ * @return The sum, or zero if the name is not in the table.
+ */
+std::size_t
+Detail_table::sum(std::string_view name) const {
+    std::uint32_t code;
+    if (!this->name_pool.find(name, code)) {
+        return 0;
+    }
+    const std::uint32_t* codes = this->name_codes.data();
+    const std::size_t* values = this->counts.data();
+    std::size_t total = 0;
+    for (std::size_t i = 0, n = this->size(); i < n; ++i) {
+        total += values[i] & -static_cast<std::size_t>(codes[i] == code);
+    }
+    return total;
+}
+
+/**
+ * @brief Finds the rows with the given name.
+ * @param name The name to filter by.
+ * @return Positions of the matching rows in ascending order.
+ */
+std::vector<std::size_t>
+Detail_table::filter(std::string_view name) const {
+    std::vector<std::size_t> rows;
+    std::uint32_t code;
+    if (!this->name_pool.find(name, code)) {
+        return rows;
+    }
+    for (std::size_t i = 0, n = this->size(); i < n; ++i) {
+        if (this->name_codes[i] == code) {
+            rows.push_back(i);
+        }
+    }
+    return rows;
+}
+
+/**
+ * @brief Sums the counts for every distinct name.
+ * @return Pairs of name and sum, in order of the first appearance of each name.
+ */
+std::vector<std::pair<std::string_view, std::size_t>>
+Detail_table::group_by_name() const {
+    std::vector<std::size_t> totals(this->name_pool.size(), 0);
+    for (std::size_t i = 0, n = this->size(); i < n; ++i) {
+        totals[this->name_codes[i]] += this->counts[i];
+    }
+    std::vector<std::pair<std::string_view, std::size_t>> groups;
+    groups.reserve(totals.size());
+    for (std::uint32_t code = 0; code < totals.size(); ++code) {
+        groups.emplace_back(this->name_pool.get(code), totals[code]);
+    }
+    return groups;
+}
+
+/**
+ * @brief Finds the rows with the largest counts.
+ *
+ * Keeps a min-heap of the best k rows seen so far, so the cost is O(n log k).
+ *
+ * @param k Number of rows to return.
+ * @return Positions of up to k rows, by descending count; ties keep the earlier row first.
+ */
+std::vector<std::size_t>
+Detail_table::top_k(std::size_t k) const {
+    auto better = [this](std::size_t a, std::size_t b) {
+        return this->counts[a] != this->counts[b] ? this->counts[a] > this->counts[b] : a < b;
+    };
+    std::vector<std::size_t> heap;
+    heap.reserve(std::min(k, this->size()));
+    for (std::size_t i = 0, n = this->size(); i < n && k != 0; ++i) {
+        if (heap.size() < k) {
+            heap.push_back(i);
+            std::push_heap(heap.begin(), heap.end(), better);
+        } else if (better(i, heap.front())) {
+            std::pop_heap(heap.begin(), heap.end(), better);
+            heap.back() = i;
+            std::push_heap(heap.begin(), heap.end(), better);
+        }
+    }
+    std::sort_heap(heap.begin(), heap.end(), better);
+    return heap;
+}
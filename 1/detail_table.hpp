@@ -0,0 +1,110 @@
+/**
+ * @file detail_table.hpp
+ * @brief Header file for the Detail_table class that stores details column by column.
+ */
+
+#ifndef LAB1_DETAIL_TABLE_HPP
+#define LAB1_DETAIL_TABLE_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "detail.hpp"
+#include "string_pool.hpp"
+
+/**
+ * @class Detail_table
+ * @brief Structure-of-arrays table of details for aggregate queries over count.
+ *
+ * Ids and names are interned; the name column holds one 32-bit code per row and the count column
+ * one std::size_t per row. Aggregates run as plain loops over these arrays, which the compiler
+ * can vectorise.
+ */
+class Detail_table {
+  private:
+    String_pool id_pool;                   ///< Pool of ids.
+    String_pool name_pool;                 ///< Pool of names.
+    std::vector<std::uint32_t> id_codes;   ///< Id column.
+    std::vector<std::uint32_t> name_codes; ///< Name column.
+    std::vector<std::size_t> counts;       ///< Count column.
+
+  public:
+    /**
+     * @brief Constructs an empty table.
+     */
+    Detail_table() = default;
+
+    /**
+     * @brief Constructs a table from decoded details.
+     * @param details The details to add.
+     */
+    Detail_table(const std::vector<Detail_info>& details);
+
+    /**
+     * @brief Appends a row.
+     * @param view The detail to append; its strings are copied into the pools.
+     */
+    void add(const Detail_view& view);
+
+    /**
+     * @brief Reserves space for the given number of rows.
+     * @param rows Number of rows.
+     */
+    void reserve(std::size_t rows);
+
+    /**
+     * @brief Returns the number of rows.
+     * @return The number of rows.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the row at the given position.
+     * @param index Position of the row.
+     * @return A view of the row, invalidated by the next call to add().
+     * @throws std::out_of_range if the index is out of range.
+     */
+    Detail_view row(std::size_t index) const;
+
+    /**
+     * @brief Returns the count column.
+     * @return The counts of all rows.
+     */
+    const std::vector<std::size_t>& count_column() const;
+
+    /**
+     * @brief Sums the counts of all rows.
+     * @return The sum.
+     */
+    std::size_t sum() const;
+
+    /**
+     * @brief Sums the counts of the rows with the given name.
+     * @param name The name to filter by.
+     * @return The sum, or zero if the name is not in the table.
+     */
+    std::size_t sum(std::string_view name) const;
+
+    /**
+     * @brief Finds the rows with the given name.
+     * @param name The name to filter by.
+     * @return Positions of the matching rows in ascending order.
+     */
+    std::vector<std::size_t> filter(std::string_view name) const;
+
+    /**
+     * @brief Sums the counts for every distinct name.
+     * @return Pairs of name and sum, in order of the first appearance of each name.
+     */
+    std::vector<std::pair<std::string_view, std::size_t>> group_by_name() const;
+
+    /**
+     * @brief Finds the rows with the largest counts.
+     * @param k Number of rows to return.
+     * @return Positions of up to k rows, by descending count; ties keep the earlier row first.
+     */
+    std::vector<std::size_t> top_k(std::size_t k) const;
+};
+
+#endif // LAB1_DETAIL_TABLE_HPP
@@ -0,0 +1,200 @@
+/**
+ * @file detail_tsv.cpp
+ * @brief Implementation of the conversion between tab-separated details and encoded records.
+ */
+
+#include "detail_tsv.hpp"
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include "detail_reader.hpp"
+#include "scan.hpp"
+
+using std::endl;
+using std::string;
+
+namespace {
+
+/**
+ * @brief Number of output bytes collected before they are written to the stream.
+ */
+constexpr std::size_t OUTPUT_BLOCK = 1 << 16;
+
+/**
+ * @brief Writes the collected output to the stream and clears it.
+ * @param out The stream to write to.
+ * @param block The collected output.
+ * @throws std::runtime_error if writing to the stream fails.
+ */
+void
+write_block(std::ostream& out, string& block) {
+    out.write(block.data(), block.size());
+    if (!out) {
+        throw std::runtime_error("Failed to write output");
+    }
+    block.clear();
+}
+
+/**
+ * @brief Appends a field of a tab-separated line, escaping tabs, line breaks and backslashes.
+ * @param out The string to append to.
+ * @param field The field to append.
+ */
+void
+append_field(string& out, std::string_view field) {
+    const char* run = field.data();
+    const char* end = run + field.size();
+    for (const char* it = run; it != end; ++it) {
+        char c = *it;
+        char escaped = c == '\t' ? 't' : c == '\n' ? 'n' : c == '\r' ? 'r' : c == '\\' ? '\\' : '\0';
+        if (escaped != '\0') {
+            out.append(run, it);
+            out.push_back('\\');
+            out.push_back(escaped);
+            run = it + 1;
+        }
+    }
+    out.append(run, end);
+}
+
+/**
+ * @brief Undoes the escape sequences of a field of a tab-separated line.
+ * @param field The raw field; replaced by its unescaped value, which points into buffer if it held escapes.
+ * @param buffer Receives the unescaped field if it holds escape sequences.
+ * @return false if the field holds an unsupported escape sequence.
+ */
+bool
+unescape_field(std::string_view& field, string& buffer) {
+    if (std::memchr(field.data(), '\\', field.size()) == nullptr) {
+        return true;
+    }
+    buffer.clear();
+    for (std::size_t i = 0; i < field.size(); ++i) {
+        if (field[i] != '\\') {
+            buffer.push_back(field[i]);
+            continue;
+        }
+        char c = ++i < field.size() ? unescape_char(field[i]) : '\0';
+        if (c == '\0') {
+            return false;
+        }
+        buffer.push_back(c);
+    }
+    field = buffer;
+    return true;
+}
+
+/**
+ * @brief Parses a line in the format <id>\t<name>\t<count>.
+ * @param line The line without its line break; a trailing carriage return is ignored.
+ * @param id_buffer Receives the id if it holds escape sequences.
+ * @param name_buffer Receives the name if it holds escape sequences.
+ * @param view Receives the parsed detail.
+ * @return false if the line is malformed.
+ */
+bool
+parse_line(std::string_view line, string& id_buffer, string& name_buffer, Detail_view& view) {
+    if (line.ends_with('\r')) {
+        line.remove_suffix(1);
+    }
+    std::size_t first = line.find('\t');
+    std::size_t second = first == std::string_view::npos ? first : line.find('\t', first + 1);
+    if (second == std::string_view::npos) {
+        return false;
+    }
+    view.id = line.substr(0, first);
+    view.name = line.substr(first + 1, second - first - 1);
+    std::string_view count = line.substr(second + 1);
+    auto [end, ec] = std::from_chars(count.data(), count.data() + count.size(), view.count);
+    return !count.empty() && ec == std::errc() && end == count.data() + count.size()
+           && unescape_field(view.id, id_buffer) && unescape_field(view.name, name_buffer);
+}
+
+} // namespace
+
+/**
+ * @brief Encodes tab-separated details, one per line, into encoded records, one per line.
+ *
+ * Input lines are <id>\t<name>\t<count>, where tabs, line breaks and backslashes in the fields are
+ * written as \\t, \\n, \\r and \\\\. Output is collected into blocks and never flushed per line.
+ * Empty lines are skipped; malformed lines are reported to stderr by number and do not stop the run.
+ *
+ * @param in The stream to read details from.
+ * @param out The stream to write encoded records to.
+ * @return 0 if every line was encoded, 1 otherwise.
+ * @throws std::runtime_error if reading or writing fails.
+ */
+int
+encode_stream(std::istream& in, std::ostream& out) {
+    string line, id_buffer, name_buffer, block;
+    std::size_t number = 0;
+    bool failed = false;
+    Detail_view view;
+    while (getline(in, line)) {
+        ++number;
+        if (line.empty()) {
+            continue;
+        }
+        if (!parse_line(line, id_buffer, name_buffer, view)) {
+            std::cerr << "line " << number << ": bad record" << endl;
+            failed = true;
+            continue;
+        }
+        view.encode_to(block);
+        block.push_back('\n');
+        if (block.size() >= OUTPUT_BLOCK) {
+            write_block(out, block);
+        }
+    }
+    if (in.bad()) {
+        throw std::runtime_error(std::string("Failed to read stream: ") + strerror(errno));
+    }
+    write_block(out, block);
+    out.flush();
+    return failed ? 1 : 0;
+}
+
+/**
+ * @brief Decodes encoded records, one per line, into tab-separated details, one per line.
+ *
+ * The output is the input format of encode_stream(). Output is collected into blocks and never
+ * flushed per line. Empty lines are skipped; malformed lines are reported to stderr by number
+ * and do not stop the run.
+ *
+ * @param in The stream to read encoded records from.
+ * @param out The stream to write details to.
+ * @return 0 if every line was decoded, 1 otherwise.
+ * @throws std::runtime_error if reading or writing fails.
+ */
+int
+decode_stream(std::istream& in, std::ostream& out) {
+    string block;
+    bool failed = false;
+    Detail_reader reader(in);
+    reader.read(
+        [&out, &block](const Detail_view& view) {
+            append_field(block, view.id);
+            block.push_back('\t');
+            append_field(block, view.name);
+            block.push_back('\t');
+            char digits[std::numeric_limits<std::size_t>::digits10 + 1];
+            block.append(digits, std::to_chars(digits, std::end(digits), view.count).ptr);
+            block.push_back('\n');
+            if (block.size() >= OUTPUT_BLOCK) {
+                write_block(out, block);
+            }
+        },
+        [&failed](std::size_t line) {
+            std::cerr << "line " << line << ": bad record" << endl;
+            failed = true;
+        });
+    write_block(out, block);
+    out.flush();
+    return failed ? 1 : 0;
+}
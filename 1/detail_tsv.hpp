@@ -0,0 +1,30 @@
+/**
+ * @file detail_tsv.hpp
+ * @brief Header file for the conversion between tab-separated details and encoded records.
+ */
+
+#ifndef LAB1_DETAIL_TSV_HPP
+#define LAB1_DETAIL_TSV_HPP
+
+#include <istream>
+#include <ostream>
+
+/**
+ * @brief Encodes tab-separated details, one per line, into encoded records, one per line.
+ * @param in The stream to read details from.
+ * @param out The stream to write encoded records to.
+ * @return 0 if every line was encoded, 1 otherwise.
+ * @throws std::runtime_error if reading or writing fails.
+ */
+int encode_stream(std::istream& in, std::ostream& out);
+
+/**
+ * @brief Decodes encoded records, one per line, into tab-separated details, one per line.
+ * @param in The stream to read encoded records from.
+ * @param out The stream to write details to.
+ * @return 0 if every line was decoded, 1 otherwise.
+ * @throws std::runtime_error if reading or writing fails.
+ */
+int decode_stream(std::istream& in, std::ostream& out);
+
+#endif // LAB1_DETAIL_TSV_HPP
@@ -4,8 +4,13 @@
  */
 
 #include "main.hpp"
+#include <cerrno>
+#include <cstring>
 #include <iostream>
 #include <limits>
+#include <stdexcept>
+#include <string_view>
+#include "detail_tsv.hpp"
 
 using std::cin;
 using std::cout;
@@ -13,13 +18,34 @@ using std::endl;
 using std::string;
 
 #define PROMPT "(d) - decode\n(e) - encode\n"
+#define USAGE "usage: lab1 [--encode | --decode]\n"
 
 /**
  * @brief Main function. Provides a prompt to either encode or decode a Detail_info object.
- * @return Returns 0 on success, 1 on failure.
+ *
+ * With --encode or --decode the records are streamed from stdin to stdout instead, without prompts.
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv Command-line arguments.
+ * @return Returns 0 on success, 1 on failure, 2 on invalid arguments.
  */
 int
-main() {
+main(int argc, char* argv[]) {
+    if (argc > 1) {
+        std::string_view mode = argv[1];
+        if (argc != 2 || (mode != "--encode" && mode != "--decode")) {
+            std::cerr << USAGE;
+            return 2;
+        }
+        std::ios::sync_with_stdio(false);
+        cin.tie(nullptr);
+        try {
+            return mode == "--encode" ? encode_stream(cin, cout) : decode_stream(cin, cout);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << endl;
+            return 1;
+        }
+    }
     char state;
     Detail_info detail;
     cout << PROMPT;
@@ -0,0 +1,265 @@
+/**
+ * @file parallel_decoder.cpp
+ * @brief Implementation of the multi-threaded decoding of newline-delimited records.
+ */
+
+#include "parallel_decoder.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <fcntl.h>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "detail_reader.hpp"
+
+namespace {
+
+/**
+ * @brief Result of decoding one chunk.
+ */
+struct Chunk {
+    std::string_view data;              ///< Lines of the chunk.
+    std::size_t lines = 0;              ///< Number of lines in the chunk.
+    std::vector<Detail_info> details;   ///< Decoded records.
+    std::vector<std::size_t> bad_lines; ///< Malformed lines, numbered within the chunk.
+    std::exception_ptr error;           ///< Exception thrown while decoding, if any.
+};
+
+/**
+ * @brief Read-only memory mapping of a file, released on destruction.
+ */
+class Mapped_file {
+  public:
+    /**
+     * @brief Maps the whole file into memory.
+     * @param path Path to the file.
+     * @throws std::runtime_error if the file cannot be opened or mapped.
+     */
+    Mapped_file(const string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw std::runtime_error("Failed to open file: " + string(strerror(errno)));
+        }
+        struct stat st;
+        if (fstat(fd, &st) == -1) {
+            int error = errno;
+            close(fd);
+            throw std::runtime_error("Failed to stat file: " + string(strerror(error)));
+        }
+        size = st.st_size;
+        if (size != 0) {
+            data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                int error = errno;
+                close(fd);
+                throw std::runtime_error("Failed to map file: " + string(strerror(error)));
+            }
+            madvise(data, size, MADV_SEQUENTIAL);
+        }
+        close(fd);
+    }
+
+    Mapped_file(const Mapped_file&) = delete;
+    Mapped_file& operator=(const Mapped_file&) = delete;
+
+    /**
+     * @brief Unmaps the file.
+     */
+    ~Mapped_file() {
+        if (size != 0) {
+            munmap(data, size);
+        }
+    }
+
+    /**
+     * @brief Returns the contents of the file.
+     * @return A view of the mapped bytes.
+     */
+    std::string_view view() const { return std::string_view(static_cast<const char*>(data), size); }
+
+  private:
+    void* data = nullptr; ///< Start of the mapping.
+    std::size_t size = 0; ///< Size of the mapping.
+};
+
+/**
+ * @brief Fixed set of worker threads reused by every call of decode_parallel().
+ *
+ * Workers are started on first use and added only when a call asks for more threads than any call
+ * before it. Between calls they sleep on a condition variable instead of exiting. One batch of tasks
+ * runs at a time, and the calling thread takes tasks from it as well.
+ */
+class Worker_pool {
+  public:
+    Worker_pool() = default;
+    Worker_pool(const Worker_pool&) = delete;
+    Worker_pool& operator=(const Worker_pool&) = delete;
+
+    /**
+     * @brief Stops and joins the workers.
+     */
+    ~Worker_pool() {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->stopping = true;
+        }
+        this->wake.notify_all();
+        for (std::thread& worker : this->workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Runs task(0), ..., task(count - 1) on the workers and the calling thread.
+     * @param count Number of tasks; the pool grows to count - 1 workers if it is smaller.
+     * @param task The task; it must not throw.
+     */
+    void run(std::size_t count, const std::function<void(std::size_t)>& task) {
+        std::lock_guard<std::mutex> batch_lock(this->batch_mutex);
+        std::unique_lock<std::mutex> lock(this->mutex);
+        while (this->workers.size() + 1 < count) {
+            this->workers.emplace_back(&Worker_pool::loop, this);
+        }
+        this->task = &task;
+        this->next = 0;
+        this->count = count;
+        this->pending = count;
+        this->wake.notify_all();
+        this->work(lock);
+        this->done.wait(lock, [this] { return this->pending == 0; });
+        this->task = nullptr;
+    }
+
+  private:
+    std::mutex batch_mutex;                                 ///< Held for the whole batch by run().
+    std::mutex mutex;                                       ///< Guards the fields below.
+    std::condition_variable wake;                           ///< Signals a new batch or stopping.
+    std::condition_variable done;                           ///< Signals that the batch is finished.
+    std::vector<std::thread> workers;                       ///< Worker threads.
+    const std::function<void(std::size_t)>* task = nullptr; ///< Task of the current batch.
+    std::size_t next = 0;                                   ///< Next task index to take.
+    std::size_t count = 0;                                  ///< Number of tasks in the current batch.
+    std::size_t pending = 0;                                ///< Number of tasks not finished yet.
+    bool stopping = false;                                  ///< Set when the pool is destroyed.
+
+    /**
+     * @brief Takes and runs tasks of the current batch until none is left to take.
+     * @param lock Lock on mutex; it is released while a task runs.
+     */
+    void work(std::unique_lock<std::mutex>& lock) {
+        while (this->next < this->count) {
+            std::size_t index = this->next++;
+            const std::function<void(std::size_t)>& current = *this->task;
+            lock.unlock();
+            current(index);
+            lock.lock();
+            if (--this->pending == 0) {
+                this->done.notify_all();
+            }
+        }
+    }
+
+    /**
+     * @brief Main loop of a worker thread.
+     */
+    void loop() {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        while (true) {
+            this->wake.wait(lock, [this] { return this->stopping || this->next < this->count; });
+            if (this->stopping) {
+                return;
+            }
+            this->work(lock);
+        }
+    }
+};
+
+/**
+ * @brief Returns the worker pool shared by all calls of decode_parallel().
+ * @return The pool.
+ */
+Worker_pool&
+worker_pool() {
+    static Worker_pool pool;
+    return pool;
+}
+
+} // namespace
+
+/**
+ * @brief Decodes a buffer with one encoded record per line on several threads.
+ *
+ * The chunks run on a pool of worker threads that lives across calls, so decoding many small files
+ * does not pay for starting threads each time.
+ *
+ * @param data The buffer to decode.
+ * @param details Receives the decoded records.
+ * @param bad_lines Receives the 1-based line numbers of malformed lines.
+ * @param threads Number of threads; zero means one per hardware thread.
+ * @return The number of decoded records.
+ */
+std::size_t
+decode_parallel(std::string_view data, std::vector<Detail_info>& details, std::vector<std::size_t>& bad_lines,
+                unsigned threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::vector<Chunk> chunks;
+    chunks.reserve(threads);
+    for (std::size_t begin = 0, i = 1; begin < data.size(); ++i) {
+        std::size_t end = i < threads ? std::max(begin, data.size() * i / threads) : data.size();
+        end = std::min(data.find('\n', end), data.size() - 1) + 1;
+        chunks.emplace_back().data = data.substr(begin, end - begin);
+        begin = end;
+    }
+    auto work = [](Chunk& chunk) {
+        try {
+            decode_lines(
+                chunk.data, chunk.lines, [&chunk](const Detail_view& view) { chunk.details.emplace_back(view); },
+                [&chunk](std::size_t line) { chunk.bad_lines.push_back(line); });
+        } catch (...) {
+            chunk.error = std::current_exception();
+        }
+    };
+    worker_pool().run(chunks.size(), [&chunks, &work](std::size_t i) { work(chunks[i]); });
+    std::size_t total = 0;
+    for (const Chunk& chunk : chunks) {
+        if (chunk.error) {
+            std::rethrow_exception(chunk.error);
+        }
+        total += chunk.details.size();
+    }
+    details.reserve(details.size() + total);
+    std::size_t line = 0;
+    for (Chunk& chunk : chunks) {
+        std::move(chunk.details.begin(), chunk.details.end(), std::back_inserter(details));
+        for (std::size_t bad_line : chunk.bad_lines) {
+            bad_lines.push_back(line + bad_line);
+        }
+        line += chunk.lines;
+    }
+    return total;
+}
+
+/**
+ * @brief Memory-maps a file with one encoded record per line and decodes it on several threads.
+ * @param path Path to the file.
+ * @param details Receives the decoded records.
+ * @param bad_lines Receives the 1-based line numbers of malformed lines.
+ * @param threads Number of threads; zero means one per hardware thread.
+ * @return The number of decoded records.
+ * @throws std::runtime_error if the file cannot be opened or mapped.
+ */
+std::size_t
+decode_file(const string& path, std::vector<Detail_info>& details, std::vector<std::size_t>& bad_lines,
+            unsigned threads) {
+    Mapped_file file(path);
+    return decode_parallel(file.view(), details, bad_lines, threads);
+}
@@ -0,0 +1,42 @@
+/**
+ * @file parallel_decoder.hpp
+ * @brief Header file for the multi-threaded decoding of newline-delimited records.
+ */
+
+#ifndef LAB1_PARALLEL_DECODER_HPP
+#define LAB1_PARALLEL_DECODER_HPP
+
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "detail.hpp"
+
+/**
+ * @brief Decodes a buffer with one encoded record per line on several threads.
+ *
+ * The buffer is split at line boundaries into one chunk per thread. The records and malformed
+ * line numbers are merged in input order, so the result equals that of a single-threaded decode.
+ * The chunks run on a pool of worker threads that is kept between calls.
+ *
+ * @param data The buffer to decode.
+ * @param details Receives the decoded records.
+ * @param bad_lines Receives the 1-based line numbers of malformed lines.
+ * @param threads Number of threads; zero means one per hardware thread.
+ * @return The number of decoded records.
+ */
+std::size_t decode_parallel(std::string_view data, std::vector<Detail_info>& details,
+                            std::vector<std::size_t>& bad_lines, unsigned threads = 0);
+
+/**
+ * @brief Memory-maps a file with one encoded record per line and decodes it on several threads.
+ * @param path Path to the file.
+ * @param details Receives the decoded records.
+ * @param bad_lines Receives the 1-based line numbers of malformed lines.
+ * @param threads Number of threads; zero means one per hardware thread.
+ * @return The number of decoded records.
+ * @throws std::runtime_error if the file cannot be opened or mapped.
+ */
+std::size_t decode_file(const string& path, std::vector<Detail_info>& details, std::vector<std::size_t>& bad_lines,
+                        unsigned threads = 0);
+
+#endif // LAB1_PARALLEL_DECODER_HPP
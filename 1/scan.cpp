@@ -0,0 +1,406 @@
+/**
+ * @file scan.cpp
+ * @brief Implementation of the character scanning functions used by the decoder.
+ */
+
+#include "scan.hpp"
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Reference implementation of find_char() examining one character at a time.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param c The character to find.
+ * @return Pointer to the first occurrence, or last if there is none.
+ */
+const char*
+find_char_scalar(const char* first, const char* last, char c) {
+    while (first != last && *first != c) {
+        ++first;
+    }
+    return first;
+}
+
+/**
+ * @brief Reference implementation of find_quote_or_escape() examining one character at a time.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param ascii Cleared if a byte with the high bit set precedes the result; never set.
+ * @return Pointer to the first quote or backslash, or last if there is none.
+ */
+const char*
+find_quote_or_escape_scalar(const char* first, const char* last, bool& ascii) {
+    unsigned char high = 0;
+    for (; first != last && *first != '\'' && *first != '\\'; ++first) {
+        high |= static_cast<unsigned char>(*first);
+    }
+    if (high & 0x80) {
+        ascii = false;
+    }
+    return first;
+}
+
+namespace {
+
+/**
+ * @brief Checks whether the encoder writes the character as an escape sequence.
+ * @param c The character to check.
+ * @return true for the quote, the backslash, tab, line feed and carriage return.
+ */
+inline bool
+is_escapable(char c) {
+    return c == '\'' || c == '\\' || c == '\t' || c == '\n' || c == '\r';
+}
+
+} // namespace
+
+/**
+ * @brief Reference implementation of find_escapable() examining one character at a time.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @return Pointer to the first character written as an escape sequence, or last if there is none.
+ */
+const char*
+find_escapable_scalar(const char* first, const char* last) {
+    while (first != last && !is_escapable(*first)) {
+        ++first;
+    }
+    return first;
+}
+
+/**
+ * @brief Finds the first byte that is not part of a well-formed UTF-8 sequence.
+ *
+ * Follows table 3-7 of the Unicode standard: the allowed range of the second byte depends on the
+ * lead byte, which rules out overlong encodings, surrogates and code points above U+10FFFF.
+ *
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @return Pointer to the start of the first malformed sequence, or last if the range is valid UTF-8.
+ */
+const char*
+find_invalid_utf8(const char* first, const char* last) {
+    while (first != last) {
+        unsigned char lead = *first;
+        if (lead < 0x80) {
+            ++first;
+            continue;
+        }
+        std::ptrdiff_t tail;
+        unsigned char low = 0x80, high = 0xbf;
+        if (lead >= 0xc2 && lead <= 0xdf) {
+            tail = 1;
+        } else if (lead >= 0xe0 && lead <= 0xef) {
+            tail = 2;
+            low = lead == 0xe0 ? 0xa0 : 0x80;
+            high = lead == 0xed ? 0x9f : 0xbf;
+        } else if (lead >= 0xf0 && lead <= 0xf4) {
+            tail = 3;
+            low = lead == 0xf0 ? 0x90 : 0x80;
+            high = lead == 0xf4 ? 0x8f : 0xbf;
+        } else {
+            return first;
+        }
+        if (last - first <= tail) {
+            return first;
+        }
+        unsigned char second = first[1];
+        if (second < low || second > high) {
+            return first;
+        }
+        for (std::ptrdiff_t i = 2; i <= tail; ++i) {
+            if ((first[i] & 0xc0) != 0x80) {
+                return first;
+            }
+        }
+        first += tail + 1;
+    }
+    return last;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ * @brief Implementation of find_char() examining 16 characters at a time with SSE2.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param c The character to find.
+ * @return Pointer to the first occurrence, or last if there is none.
+ */
+__attribute__((target("sse2"))) const char*
+find_char_sse2(const char* first, const char* last, char c) {
+    const __m128i needle = _mm_set1_epi8(c);
+    for (; last - first >= 16; first += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle));
+        if (mask != 0) {
+            return first + __builtin_ctz(mask);
+        }
+    }
+    return find_char_scalar(first, last, c);
+}
+
+/**
+ * @brief Implementation of find_char() examining 32 characters at a time with AVX2.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param c The character to find.
+ * @return Pointer to the first occurrence, or last if there is none.
+ */
+__attribute__((target("avx2"))) const char*
+find_char_avx2(const char* first, const char* last, char c) {
+    const __m256i needle = _mm256_set1_epi8(c);
+    for (; last - first >= 32; first += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        unsigned mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle));
+        if (mask != 0) {
+            return first + __builtin_ctz(mask);
+        }
+    }
+    return find_char_sse2(first, last, c);
+}
+
+/**
+ * @brief Implementation of find_quote_or_escape() examining 16 characters at a time with SSE2.
+ *
+ * The blocks are OR-ed together as they are loaded, so the ASCII check costs one extra vector OR
+ * per block and a single movemask at the end.
+ *
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param ascii Cleared if a byte with the high bit set precedes the result; never set.
+ * @return Pointer to the first quote or backslash, or last if there is none.
+ */
+__attribute__((target("sse2"))) const char*
+find_quote_or_escape_sse2(const char* first, const char* last, bool& ascii) {
+    const __m128i quote = _mm_set1_epi8('\''), backslash = _mm_set1_epi8('\\');
+    __m128i seen = _mm_setzero_si128();
+    for (; last - first >= 16; first += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        unsigned mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)));
+        if (mask != 0) {
+            unsigned position = __builtin_ctz(mask);
+            unsigned before = _mm_movemask_epi8(chunk) & ((1u << position) - 1);
+            if ((_mm_movemask_epi8(seen) | before) != 0) {
+                ascii = false;
+            }
+            return first + position;
+        }
+        seen = _mm_or_si128(seen, chunk);
+    }
+    if (_mm_movemask_epi8(seen) != 0) {
+        ascii = false;
+    }
+    return find_quote_or_escape_scalar(first, last, ascii);
+}
+
+/**
+ * @brief Implementation of find_quote_or_escape() examining 32 characters at a time with AVX2.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param ascii Cleared if a byte with the high bit set precedes the result; never set.
+ * @return Pointer to the first quote or backslash, or last if there is none.
+ */
+__attribute__((target("avx2"))) const char*
+find_quote_or_escape_avx2(const char* first, const char* last, bool& ascii) {
+    const __m256i quote = _mm256_set1_epi8('\''), backslash = _mm256_set1_epi8('\\');
+    __m256i seen = _mm256_setzero_si256();
+    // Two blocks per iteration; the masks are only extracted once a quote or backslash shows up.
+    for (; last - first >= 64; first += 64) {
+        __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + 32));
+        __m256i low_found = _mm256_or_si256(_mm256_cmpeq_epi8(low, quote), _mm256_cmpeq_epi8(low, backslash));
+        __m256i high_found = _mm256_or_si256(_mm256_cmpeq_epi8(high, quote), _mm256_cmpeq_epi8(high, backslash));
+        __m256i found = _mm256_or_si256(low_found, high_found);
+        if (!_mm256_testz_si256(found, found)) {
+            std::uint64_t mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(low_found))
+                                 | static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(high_found))) << 32;
+            std::uint64_t bits = static_cast<std::uint32_t>(_mm256_movemask_epi8(low))
+                                 | static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(high))) << 32;
+            unsigned position = __builtin_ctzll(mask);
+            if (_mm256_movemask_epi8(seen) != 0 || (bits & ((std::uint64_t{1} << position) - 1)) != 0) {
+                ascii = false;
+            }
+            return first + position;
+        }
+        seen = _mm256_or_si256(seen, _mm256_or_si256(low, high));
+    }
+    for (; last - first >= 32; first += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        unsigned mask = _mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote), _mm256_cmpeq_epi8(chunk, backslash)));
+        if (mask != 0) {
+            unsigned position = __builtin_ctz(mask);
+            unsigned before = _mm256_movemask_epi8(chunk) & ((1u << position) - 1);
+            if ((_mm256_movemask_epi8(seen) | before) != 0) {
+                ascii = false;
+            }
+            return first + position;
+        }
+        seen = _mm256_or_si256(seen, chunk);
+    }
+    if (_mm256_movemask_epi8(seen) != 0) {
+        ascii = false;
+    }
+    // The SSE2 tail is not VEX-encoded; clear the upper halves to avoid the transition penalty.
+    _mm256_zeroupper();
+    return find_quote_or_escape_sse2(first, last, ascii);
+}
+
+/**
+ * @brief Implementation of find_escapable() examining 16 characters at a time with SSE2.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @return Pointer to the first character written as an escape sequence, or last if there is none.
+ */
+__attribute__((target("sse2"))) const char*
+find_escapable_sse2(const char* first, const char* last) {
+    const __m128i quote = _mm_set1_epi8('\''), backslash = _mm_set1_epi8('\\'), tab = _mm_set1_epi8('\t'),
+                  line_feed = _mm_set1_epi8('\n'), carriage_return = _mm_set1_epi8('\r');
+    for (; last - first >= 16; first += 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        __m128i found = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+                                     _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, tab), _mm_cmpeq_epi8(chunk, line_feed)),
+                                                  _mm_cmpeq_epi8(chunk, carriage_return)));
+        int mask = _mm_movemask_epi8(found);
+        if (mask != 0) {
+            return first + __builtin_ctz(mask);
+        }
+    }
+    return find_escapable_scalar(first, last);
+}
+
+/**
+ * @brief Implementation of find_escapable() examining 32 characters at a time with AVX2.
+ *
+ * The five characters have distinct low nibbles, so a byte shuffle maps every byte to the only
+ * character with its low nibble that needs escaping, and one comparison finds all of them. Bytes
+ * with the high bit set are shuffled to zero and never match.
+ *
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @return Pointer to the first character written as an escape sequence, or last if there is none.
+ */
+__attribute__((target("avx2"))) const char*
+find_escapable_avx2(const char* first, const char* last) {
+    // Unused entries hold a byte whose low nibble differs from the index.
+    const __m256i table = _mm256_setr_epi8(1, 0, 1, 1, 1, 1, 1, '\'', 1, '\t', '\n', 1, '\\', '\r', 1, 1,
+                                           1, 0, 1, 1, 1, 1, 1, '\'', 1, '\t', '\n', 1, '\\', '\r', 1, 1);
+    for (; last - first >= 32; first += 32) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        unsigned mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_shuffle_epi8(table, chunk), chunk));
+        if (mask != 0) {
+            return first + __builtin_ctz(mask);
+        }
+    }
+    // The SSE2 tail is not VEX-encoded; clear the upper halves to avoid the transition penalty.
+    _mm256_zeroupper();
+    return find_escapable_sse2(first, last);
+}
+#endif
+
+namespace {
+
+using find_char_fn = const char* (*)(const char*, const char*, char);
+
+/**
+ * @brief Selects the widest find_char() implementation supported by the processor.
+ * @return Pointer to the selected implementation.
+ */
+find_char_fn
+select_find_char() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return find_char_avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return find_char_sse2;
+    }
+#endif
+    return find_char_scalar;
+}
+
+using find_quote_or_escape_fn = const char* (*)(const char*, const char*, bool&);
+
+/**
+ * @brief Selects the widest find_quote_or_escape() implementation supported by the processor.
+ * @return Pointer to the selected implementation.
+ */
+find_quote_or_escape_fn
+select_find_quote_or_escape() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return find_quote_or_escape_avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return find_quote_or_escape_sse2;
+    }
+#endif
+    return find_quote_or_escape_scalar;
+}
+
+using find_escapable_fn = const char* (*)(const char*, const char*);
+
+/**
+ * @brief Selects the widest find_escapable() implementation supported by the processor.
+ * @return Pointer to the selected implementation.
+ */
+find_escapable_fn
+select_find_escapable() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return find_escapable_avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return find_escapable_sse2;
+    }
+#endif
+    return find_escapable_scalar;
+}
+
+} // namespace
+
+/**
+ * @brief Finds the first occurrence of a character in a range.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param c The character to find.
+ * @return Pointer to the first occurrence, or last if there is none.
+ */
+const char*
+find_char(const char* first, const char* last, char c) {
+    static const find_char_fn impl = select_find_char();
+    return impl(first, last, c);
+}
+
+/**
+ * @brief Finds the first quote or backslash in a range, which ends a run of plain field characters.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param ascii Cleared if a byte with the high bit set precedes the result; never set.
+ * @return Pointer to the first quote or backslash, or last if there is none.
+ */
+const char*
+find_quote_or_escape(const char* first, const char* last, bool& ascii) {
+    static const find_quote_or_escape_fn impl = select_find_quote_or_escape();
+    return impl(first, last, ascii);
+}
+
+/**
+ * @brief Finds the first character the encoder writes as an escape sequence.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @return Pointer to the first such character, or last if there is none.
+ */
+const char*
+find_escapable(const char* first, const char* last) {
+    static const find_escapable_fn impl = select_find_escapable();
+    return impl(first, last);
+}
@@ -0,0 +1,177 @@
+/**
+ * @file scan.hpp
+ * @brief Header file for the character scanning functions used by the decoder.
+ */
+
+#ifndef LAB1_SCAN_HPP
+#define LAB1_SCAN_HPP
+
+/**
+ * @brief Checks whether the character is whitespace (space, tab, line feed, vertical tab, form feed, carriage return).
+ * @param c The character to check.
+ * @return true if the character is whitespace.
+ */
+inline bool
+is_space(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+/**
+ * @brief Maps the character after a backslash to the character the escape sequence stands for.
+ * @param c The character after the backslash.
+ * @return The unescaped character, or '\0' if the escape sequence is not supported.
+ */
+inline char
+unescape_char(char c) {
+    switch (c) {
+    case '\'':
+    case '\\':
+        return c;
+    case 't':
+        return '\t';
+    case 'n':
+        return '\n';
+    case 'r':
+        return '\r';
+    default:
+        return '\0';
+    }
+}
+
+/**
+ * @brief Finds the first occurrence of a character in a range.
+ *
+ * Uses the widest implementation supported by the processor, selected once at runtime via CPUID.
+ *
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param c The character to find.
+ * @return Pointer to the first occurrence, or last if there is none.
+ */
+const char* find_char(const char* first, const char* last, char c);
+
+/**
+ * @brief Reference implementation of find_char() examining one character at a time.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param c The character to find.
+ * @return Pointer to the first occurrence, or last if there is none.
+ */
+const char* find_char_scalar(const char* first, const char* last, char c);
+
+/**
+ * @brief Finds the first quote or backslash in a range, which ends a run of plain field characters.
+ *
+ * Uses the widest implementation supported by the processor, selected once at runtime via CPUID.
+ *
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param ascii Cleared if a byte with the high bit set precedes the result; never set.
+ * @return Pointer to the first quote or backslash, or last if there is none.
+ */
+const char* find_quote_or_escape(const char* first, const char* last, bool& ascii);
+
+/**
+ * @brief Reference implementation of find_quote_or_escape() examining one character at a time.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param ascii Cleared if a byte with the high bit set precedes the result; never set.
+ * @return Pointer to the first quote or backslash, or last if there is none.
+ */
+const char* find_quote_or_escape_scalar(const char* first, const char* last, bool& ascii);
+
+/**
+ * @brief Finds the first character the encoder writes as an escape sequence.
+ *
+ * These are the quote, the backslash, tab, line feed and carriage return.
+ * Uses the widest implementation supported by the processor, selected once at runtime via CPUID.
+ *
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @return Pointer to the first such character, or last if there is none.
+ */
+const char* find_escapable(const char* first, const char* last);
+
+/**
+ * @brief Reference implementation of find_escapable() examining one character at a time.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @return Pointer to the first such character, or last if there is none.
+ */
+const char* find_escapable_scalar(const char* first, const char* last);
+
+/**
+ * @brief Finds the first byte that is not part of a well-formed UTF-8 sequence.
+ *
+ * Overlong encodings, surrogates and code points above U+10FFFF are rejected.
+ *
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @return Pointer to the start of the first malformed sequence, or last if the range is valid UTF-8.
+ */
+const char* find_invalid_utf8(const char* first, const char* last);
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ * @brief Implementation of find_char() examining 16 characters at a time with SSE2.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param c The character to find.
+ * @return Pointer to the first occurrence, or last if there is none.
+ */
+const char* find_char_sse2(const char* first, const char* last, char c);
+
+/**
+ * @brief Implementation of find_char() examining 32 characters at a time with AVX2.
+ *
+ * Must only be called when the processor supports AVX2.
+ *
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param c The character to find.
+ * @return Pointer to the first occurrence, or last if there is none.
+ */
+const char* find_char_avx2(const char* first, const char* last, char c);
+
+/**
+ * @brief Implementation of find_quote_or_escape() examining 16 characters at a time with SSE2.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param ascii Cleared if a byte with the high bit set precedes the result; never set.
+ * @return Pointer to the first quote or backslash, or last if there is none.
+ */
+const char* find_quote_or_escape_sse2(const char* first, const char* last, bool& ascii);
+
+/**
+ * @brief Implementation of find_quote_or_escape() examining 32 characters at a time with AVX2.
+ *
+ * Must only be called when the processor supports AVX2.
+ *
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @param ascii Cleared if a byte with the high bit set precedes the result; never set.
+ * @return Pointer to the first quote or backslash, or last if there is none.
+ */
+const char* find_quote_or_escape_avx2(const char* first, const char* last, bool& ascii);
+
+/**
+ * @brief Implementation of find_escapable() examining 16 characters at a time with SSE2.
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @return Pointer to the first character written as an escape sequence, or last if there is none.
+ */
+const char* find_escapable_sse2(const char* first, const char* last);
+
+/**
+ * @brief Implementation of find_escapable() examining 32 characters at a time with AVX2.
+ *
+ * Must only be called when the processor supports AVX2.
+ *
+ * @param first Start of the range.
+ * @param last End of the range.
+ * @return Pointer to the first character written as an escape sequence, or last if there is none.
+ */
+const char* find_escapable_avx2(const char* first, const char* last);
+#endif
+
+#endif // LAB1_SCAN_HPP
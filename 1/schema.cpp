@@ -0,0 +1,97 @@
+/**
+ * @file schema.cpp
+ * @brief Implementation of the non-template parts of the schema-driven codec.
+ */
+
+#include "schema.hpp"
+#include <string>
+#include <string_view>
+#include "scan.hpp"
+
+/**
+ * @brief Returns a human-readable description of a decoding failure.
+ * @param reason The reason of the failure.
+ * @return A static string describing the reason.
+ */
+std::string_view
+describe(Decode_reason reason) {
+    switch (reason) {
+    case Decode_reason::NO_RECORD:
+        return "no record";
+    case Decode_reason::EXPECTED_KEY:
+        return "expected key";
+    case Decode_reason::EXPECTED_COLON:
+        return "expected ':'";
+    case Decode_reason::EXPECTED_COMMA:
+        return "expected ','";
+    case Decode_reason::EXPECTED_QUOTE:
+        return "expected opening quote";
+    case Decode_reason::UNTERMINATED_STRING:
+        return "unterminated string";
+    case Decode_reason::INVALID_ESCAPE:
+        return "invalid escape sequence";
+    case Decode_reason::INVALID_UTF8:
+        return "invalid UTF-8";
+    case Decode_reason::NEEDS_BUFFER:
+        return "escape sequence without a buffer";
+    case Decode_reason::EXPECTED_DIGIT:
+        return "expected digit";
+    case Decode_reason::COUNT_OVERFLOW:
+        return "number overflow";
+    case Decode_reason::EXPECTED_CLOSING_BRACE:
+        return "expected '}'";
+    }
+    return "unknown error";
+}
+
+/**
+ * @brief Returns the length of a field once escaped by escape_to().
+ * @param field The field to measure.
+ * @return The number of characters escape_to() writes.
+ */
+std::size_t
+escaped_size(std::string_view field) {
+    std::size_t size = field.size();
+    const char* end = field.data() + field.size();
+    for (const char* it = find_escapable(field.data(), end); it != end; it = find_escapable(it + 1, end)) {
+        ++size;
+    }
+    return size;
+}
+
+/**
+ * @brief Unescapes the rest of a quoted field that holds escape sequences.
+ *
+ * Kept out of line so that the common path of scan_value() without escapes stays small enough to inline.
+ *
+ * @param it Position of the first backslash, advanced past the closing quote on success.
+ * @param run Start of the payload.
+ * @param end End of the input.
+ * @param out The unescaped payload is appended to it.
+ * @param reason Set to the reason of the failure.
+ * @return true if a complete quoted field was found.
+ */
+bool
+unescape_run(const char*& it, const char* run, const char* end, std::string& out, Decode_reason& reason) {
+    while (*it == '\\') {
+        out.append(run, it);
+        if (++it == end) {
+            reason = Decode_reason::UNTERMINATED_STRING;
+            return false;
+        }
+        char c = unescape_char(*it);
+        if (c == '\0') {
+            reason = Decode_reason::INVALID_ESCAPE;
+            return false;
+        }
+        out.push_back(c);
+        run = ++it;
+        bool ascii = true;
+        it = find_quote_or_escape(it, end, ascii);
+        if (!check_run(it, run, end, ascii, reason)) {
+            return false;
+        }
+    }
+    out.append(run, it++);
+    return true;
+}
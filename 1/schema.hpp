@@ -0,0 +1,730 @@
+/**
+ * @file schema.hpp
+ * @brief Header file for the schema-driven codec of JSON-like records.
+ *
+ * A record type is described once as a list of keys and the members they map to, and Schema
+ * generates the encoder and the single-pass decoder for it at compile time.
+ */
+
+#ifndef LAB1_SCHEMA_HPP
+#define LAB1_SCHEMA_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <expected>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include "scan.hpp"
+
+/**
+ * @brief Error codes for Detail_info.
+ */
+typedef enum _errors {
+    BAD_JSON,  ///< Error thrown when decoding a malformed JSON string.
+    BAD_BINARY ///< Error thrown when decoding malformed binary data.
+} errors;
+
+/**
+ * @brief Reasons why a JSON-like record could not be decoded.
+ */
+enum class Decode_reason {
+    NO_RECORD,              ///< The input contains no opening brace.
+    EXPECTED_KEY,           ///< A key is missing, misspelled or out of order.
+    EXPECTED_COLON,         ///< A colon after a key is missing.
+    EXPECTED_COMMA,         ///< A comma between fields is missing.
+    EXPECTED_QUOTE,         ///< The opening quote of a string field is missing.
+    UNTERMINATED_STRING,    ///< A string field has no closing quote.
+    INVALID_ESCAPE,         ///< A backslash is followed by a character other than ', \\, t, n or r.
+    INVALID_UTF8,           ///< A string field is not well-formed UTF-8.
+    NEEDS_BUFFER,           ///< A string field has escape sequences, but no buffer was given to unescape them into.
+    EXPECTED_DIGIT,         ///< A number has no digits.
+    COUNT_OVERFLOW,         ///< A number does not fit into its member.
+    EXPECTED_CLOSING_BRACE, ///< The closing brace is missing.
+};
+
+/**
+ * @brief Error reported by the non-throwing decoders.
+ *
+ * When the input holds several candidate records, the error describes the one that got furthest.
+ */
+struct Decode_error {
+    std::size_t position = 0;                       ///< Offset of the offending character in the input.
+    Decode_reason reason = Decode_reason::NO_RECORD; ///< What was expected at that position.
+};
+
+/**
+ * @brief Returns a human-readable description of a decoding failure.
+ * @param reason The reason of the failure.
+ * @return A static string describing the reason.
+ */
+std::string_view describe(Decode_reason reason);
+
+/**
+ * @brief Writes a field with the quote, the backslash, tab, line feed and carriage return escaped.
+ * @tparam OutputIt An output iterator accepting char.
+ * @param field The field to write.
+ * @param out The iterator to write to.
+ * @return The iterator past the last written character.
+ */
+template <typename OutputIt>
+OutputIt escape_to(std::string_view field, OutputIt out);
+
+/**
+ * @brief Returns the length of a field once escaped by escape_to().
+ * @param field The field to measure.
+ * @return The number of characters escape_to() writes.
+ */
+std::size_t escaped_size(std::string_view field);
+
+/**
+ * @brief Member types a schema can encode and decode.
+ *
+ * Strings and string views are written as quoted, escaped fields; unsigned integers as decimal numbers.
+ * A std::string member owns its unescaped value, a std::string_view member points into the input
+ * or, if the field has escape sequences, into a caller-owned buffer.
+ */
+template <typename T>
+concept Schema_value = std::same_as<T, std::string> || std::same_as<T, std::string_view>
+                       || (std::unsigned_integral<T> && !std::same_as<T, bool>);
+
+/**
+ * @struct Fixed_string
+ * @brief String literal usable as a template argument, so that keys are known at compile time.
+ * @tparam N Size of the literal including the terminating null character.
+ */
+template <std::size_t N>
+struct Fixed_string {
+    char text[N] = {}; ///< Characters of the literal.
+
+    /**
+     * @brief Constructs an empty string of N - 1 null characters.
+     */
+    constexpr Fixed_string() = default;
+
+    /**
+     * @brief Copies a string literal.
+     * @param literal The literal to copy.
+     */
+    constexpr Fixed_string(const char (&literal)[N]) { std::copy(literal, literal + N, this->text); }
+
+    /**
+     * @brief Returns the literal without the terminating null character.
+     * @return A view of the literal.
+     */
+    constexpr std::string_view view() const { return std::string_view(this->text, N - 1); }
+};
+
+/**
+ * @brief Puts a key between quotes at compile time.
+ * @tparam N Size of the key including the terminating null character.
+ * @param key The key.
+ * @return The key in the form '<key>'.
+ */
+template <std::size_t N>
+constexpr Fixed_string<N + 2>
+quote(const Fixed_string<N>& key) {
+    Fixed_string<N + 2> quoted;
+    quoted.text[0] = '\'';
+    std::copy(key.text, key.text + N - 1, quoted.text + 1);
+    quoted.text[N] = '\'';
+    return quoted;
+}
+
+/**
+ * @brief Splits a pointer to data member into the class and the member type.
+ * @tparam T Type of the pointer to data member.
+ */
+template <typename T>
+struct Member_traits;
+
+/**
+ * @brief Splits a pointer to data member into the class and the member type.
+ * @tparam Class The class the member belongs to.
+ * @tparam Member Type of the member.
+ */
+template <typename Class, typename Member>
+struct Member_traits<Member Class::*> {
+    using class_type = Class;  ///< The class the member belongs to.
+    using value_type = Member; ///< Type of the member.
+};
+
+/**
+ * @struct Field
+ * @brief One field of a schema: its key in the encoded record and the member holding its value.
+ *
+ * Both are template arguments, so the decoder compares the key against constants and accesses the
+ * member at a fixed offset, as a parser written by hand would.
+ *
+ * @tparam Key Key of the field, written between quotes.
+ * @tparam Member Pointer to the data member holding the value.
+ */
+template <Fixed_string Key, auto Member>
+    requires Schema_value<typename Member_traits<decltype(Member)>::value_type>
+struct Field {
+    using class_type = typename Member_traits<decltype(Member)>::class_type; ///< The record type.
+    using value_type = typename Member_traits<decltype(Member)>::value_type; ///< Type of the member.
+
+    static constexpr Fixed_string quoted = quote(Key);     ///< Key of the field between quotes.
+    static constexpr std::string_view key = quoted.view(); ///< Key of the field as written, with the quotes.
+    static constexpr auto member = Member;                 ///< Pointer to the data member holding the value.
+};
+
+/**
+ * @brief Skips whitespace and then consumes the given literal.
+ * @param it Current position, advanced past the literal on success.
+ * @param end End of the input.
+ * @param literal The literal to consume.
+ * @return true if the literal was found.
+ */
+[[gnu::always_inline]] inline bool
+scan_literal(const char*& it, const char* end, std::string_view literal) {
+    while (it != end && is_space(*it)) {
+        ++it;
+    }
+    if (static_cast<std::size_t>(end - it) < literal.size() || std::memcmp(it, literal.data(), literal.size()) != 0) {
+        return false;
+    }
+    it += literal.size();
+    return true;
+}
+
+/**
+ * @brief Skips whitespace and then consumes the given literal, recording the reason on failure.
+ * @param it Current position, advanced past the literal on success.
+ * @param end End of the input.
+ * @param literal The literal to consume.
+ * @param failure Reason to record if the literal is missing.
+ * @param reason Set to failure if the literal is missing.
+ * @return true if the literal was found.
+ */
+[[gnu::always_inline]] inline bool
+expect_literal(const char*& it, const char* end, std::string_view literal, Decode_reason failure,
+               Decode_reason& reason) {
+    if (!scan_literal(it, end, literal)) {
+        reason = failure;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Checks a run of field characters that ends at a quote, a backslash or the end of the input.
+ * @param it End of the run; moved to the first malformed UTF-8 sequence on failure.
+ * @param run Start of the run.
+ * @param end End of the input.
+ * @param ascii Whether the run is known to hold only ASCII characters.
+ * @param reason Set to the reason of the failure.
+ * @return true if the run is well-formed UTF-8 and the input continues after it.
+ */
+[[gnu::always_inline]] inline bool
+check_run(const char*& it, const char* run, const char* end, bool ascii, Decode_reason& reason) {
+    if (!ascii) {
+        const char* invalid = find_invalid_utf8(run, it);
+        if (invalid != it) {
+            it = invalid;
+            reason = Decode_reason::INVALID_UTF8;
+            return false;
+        }
+    }
+    if (it == end) {
+        reason = Decode_reason::UNTERMINATED_STRING;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Unescapes the rest of a quoted field that holds escape sequences.
+ * @param it Position of the first backslash, advanced past the closing quote on success.
+ * @param run Start of the payload.
+ * @param end End of the input.
+ * @param out The unescaped payload is appended to it.
+ * @param reason Set to the reason of the failure.
+ * @return true if a complete quoted field was found.
+ */
+bool unescape_run(const char*& it, const char* run, const char* end, std::string& out, Decode_reason& reason);
+
+/**
+ * @brief Consumes a quoted field of the form '<payload>' into a view.
+ *
+ * The payload is scanned for the closing quote and for backslashes in one pass, which also tells
+ * whether it is pure ASCII; only payloads with other bytes are checked for well-formed UTF-8.
+ * A payload without escape sequences is returned in place, the others are unescaped into the buffer,
+ * which is reserved for the rest of the input first so that earlier fields stay valid.
+ *
+ * @param it Current position, advanced past the closing quote on success.
+ * @param end End of the input.
+ * @param value Set to the unescaped payload.
+ * @param reason Set to the reason of the failure.
+ * @param buffer Receives payloads with escape sequences; nullptr if there is none.
+ * @return true if a complete quoted field was found.
+ */
+[[gnu::always_inline]] inline bool
+scan_value(const char*& it, const char* end, std::string_view& value, Decode_reason& reason, std::string* buffer) {
+    if (!expect_literal(it, end, "'", Decode_reason::EXPECTED_QUOTE, reason)) {
+        return false;
+    }
+    const char* run = it;
+    bool ascii = true;
+    it = find_quote_or_escape(it, end, ascii);
+    if (!check_run(it, run, end, ascii, reason)) {
+        return false;
+    }
+    if (*it == '\'') {
+        value = std::string_view(run, it++ - run);
+        return true;
+    }
+    if (buffer == nullptr) {
+        reason = Decode_reason::NEEDS_BUFFER;
+        return false;
+    }
+    buffer->reserve(buffer->size() + (end - run));
+    std::size_t start = buffer->size();
+    // Only copies are passed by reference, so the fast path keeps its state in registers.
+    const char* cursor = it;
+    Decode_reason failure = reason;
+    bool found = unescape_run(cursor, run, end, *buffer, failure);
+    it = cursor;
+    reason = failure;
+    value = std::string_view(buffer->data() + start, buffer->size() - start);
+    return found;
+}
+
+/**
+ * @brief Consumes a quoted field of the form '<payload>' into a string.
+ *
+ * The payload is checked the same way as for a view; a payload with escape sequences is unescaped
+ * straight into the string.
+ *
+ * @param it Current position, advanced past the closing quote on success.
+ * @param end End of the input.
+ * @param value Set to the unescaped payload.
+ * @param reason Set to the reason of the failure.
+ * @param buffer Unused; strings own their payload.
+ * @return true if a complete quoted field was found.
+ */
+[[gnu::always_inline]] inline bool
+scan_value(const char*& it, const char* end, std::string& value, Decode_reason& reason, std::string*) {
+    if (!expect_literal(it, end, "'", Decode_reason::EXPECTED_QUOTE, reason)) {
+        return false;
+    }
+    const char* run = it;
+    bool ascii = true;
+    it = find_quote_or_escape(it, end, ascii);
+    if (!check_run(it, run, end, ascii, reason)) {
+        return false;
+    }
+    if (*it == '\'') {
+        value.assign(run, it++);
+        return true;
+    }
+    value.clear();
+    const char* cursor = it;
+    Decode_reason failure = reason;
+    bool found = unescape_run(cursor, run, end, value, failure);
+    it = cursor;
+    reason = failure;
+    return found;
+}
+
+/**
+ * @brief Consumes a non-empty sequence of decimal digits.
+ * @tparam T Unsigned integer type of the value.
+ * @param it Current position, advanced past the digits on success.
+ * @param end End of the input.
+ * @param value Set to the parsed number.
+ * @param reason Set to the reason of the failure.
+ * @param buffer Unused; numbers are never escaped.
+ * @return true if at least one digit was found and the value fits into T.
+ */
+template <std::unsigned_integral T>
+[[gnu::always_inline]] inline bool
+scan_value(const char*& it, const char* end, T& value, Decode_reason& reason, std::string*) {
+    while (it != end && is_space(*it)) {
+        ++it;
+    }
+    const char* first = it;
+    value = 0;
+    for (; it != end && *it >= '0' && *it <= '9'; ++it) {
+        T digit = *it - '0';
+        if (value > (std::numeric_limits<T>::max() - digit) / 10) {
+            reason = Decode_reason::COUNT_OVERFLOW;
+            return false;
+        }
+        value = value * 10 + digit;
+    }
+    if (it == first) {
+        reason = Decode_reason::EXPECTED_DIGIT;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @class Schema
+ * @brief Encoder and decoder of a record type in the JSON-like format, generated from its list of fields.
+ *
+ * A record is written as {'<key>':<value>,...} with the fields in schema order; the decoder expects
+ * them in the same order and allows whitespace between tokens. Every field is matched by code
+ * specialised for its key and member type, so the decoder is a single pass over the input with no
+ * lookups, the same as a parser written by hand for the record:
+ *
+ * @code
+ * struct Part { std::string code; std::uint32_t weight; };
+ * using Part_schema = Schema<Field<"code", &Part::code>, Field<"weight", &Part::weight>>;
+ * @endcode
+ *
+ * @tparam Fields The fields in the order they are written and expected; all of them belong to one class,
+ *                which must be default-constructible to be returned by try_decode().
+ */
+template <typename... Fields>
+class Schema {
+  public:
+    using Class = typename std::tuple_element_t<0, std::tuple<Fields...>>::class_type; ///< The record type.
+
+    static_assert((std::same_as<typename Fields::class_type, Class> && ...),
+                  "all fields of a schema must belong to the same class");
+
+  private:
+    /**
+     * @brief Consumes one field, preceded by a comma unless it is the first one.
+     * @tparam I Index of the field in the schema.
+     * @param it Current position, advanced past the field on success.
+     * @param end End of the input.
+     * @param object Receives the value.
+     * @param reason Set to the reason of the failure.
+     * @param buffer Receives string view payloads with escape sequences; nullptr if there is none.
+     * @return true if the field was found.
+     */
+    template <std::size_t I>
+    static bool scan_field(const char*& it, const char* end, Class& object, Decode_reason& reason,
+                           std::string* buffer);
+
+    /**
+     * @brief Consumes all fields in schema order.
+     * @param it Current position, advanced past the fields on success.
+     * @param end End of the input.
+     * @param object Receives the values.
+     * @param reason Set to the reason of the failure.
+     * @param buffer Receives string view payloads with escape sequences; nullptr if there is none.
+     * @return true if every field was found.
+     */
+    template <std::size_t... I>
+    static bool scan_fields(const char*& it, const char* end, Class& object, Decode_reason& reason,
+                            std::string* buffer, std::index_sequence<I...>);
+
+  public:
+    /**
+     * @brief Writes the encoded record to an output iterator.
+     * @tparam OutputIt An output iterator accepting char.
+     * @param object The record to encode.
+     * @param out The iterator to write to.
+     * @return The iterator past the last written character.
+     */
+    template <typename OutputIt>
+    static OutputIt encode_to(const Class& object, OutputIt out);
+
+    /**
+     * @brief Returns the length of the encoded record.
+     * @param object The record to measure.
+     * @return The number of characters written by encode_to().
+     */
+    static std::size_t encoded_size(const Class& object);
+
+    /**
+     * @brief Returns an upper bound of the length of the encoded record that does not scan the fields.
+     *
+     * It assumes every string character is escaped and every number has the most digits of its type.
+     *
+     * @param object The record to measure.
+     * @return A number of characters encode_to() never exceeds.
+     */
+    static std::size_t max_encoded_size(const Class& object);
+
+    /**
+     * @brief Parses one record starting at an opening brace.
+     * @param it Position of the opening brace; left at the offending character on failure.
+     * @param end End of the input.
+     * @param object Receives the values.
+     * @param reason Set to the reason of the failure.
+     * @param buffer Receives string view payloads with escape sequences; nullptr if there is none.
+     * @return true if a complete record was parsed.
+     */
+    static bool scan(const char*& it, const char* end, Class& object, Decode_reason& reason, std::string* buffer);
+
+    /**
+     * @brief Finds the first record in the input.
+     * @param begin Start of the input.
+     * @param end End of the input.
+     * @param object Receives the values.
+     * @param error Receives the position and reason of the failure.
+     * @param buffer Cleared and then receives string view payloads with escape sequences; nullptr if there is none.
+     * @return true if a record was found.
+     */
+    static bool find(const char* begin, const char* end, Class& object, Decode_error& error, std::string* buffer);
+
+    /**
+     * @brief Decodes the first record in a string without throwing.
+     * @param str A string holding the record; text around it is skipped.
+     * @param buffer Cleared and then receives string view payloads with escape sequences; nullptr if there is none.
+     * @return The decoded record, or the position and reason of the failure.
+     */
+    static std::expected<Class, Decode_error> try_decode(std::string_view str, std::string* buffer);
+
+    /**
+     * @brief Decodes the first record in a string.
+     * @param str A string holding the record; text around it is skipped.
+     * @param object Receives the values.
+     * @param buffer Cleared and then receives string view payloads with escape sequences; nullptr if there is none.
+     * @throws errors::BAD_JSON if the string holds no record of this schema.
+     */
+    static void decode(std::string_view str, Class& object, std::string* buffer);
+};
+
+/**
+ * @brief Writes a field with the quote, the backslash, tab, line feed and carriage return escaped.
+ *
+ * Runs without such characters are found with find_escapable() and copied at once.
+ *
+ * @tparam OutputIt An output iterator accepting char.
+ * @param field The field to write.
+ * @param out The iterator to write to.
+ * @return The iterator past the last written character.
+ */
+template <typename OutputIt>
+OutputIt
+escape_to(std::string_view field, OutputIt out) {
+    const char* it = field.data();
+    const char* end = it + field.size();
+    while (true) {
+        const char* next = find_escapable(it, end);
+        out = std::copy(it, next, out);
+        if (next == end) {
+            return out;
+        }
+        *out++ = '\\';
+        *out++ = *next == '\t' ? 't' : *next == '\n' ? 'n' : *next == '\r' ? 'r' : *next;
+        it = next + 1;
+    }
+}
+
+/**
+ * @brief Consumes one field, preceded by a comma unless it is the first one.
+ * @tparam I Index of the field in the schema.
+ * @param it Current position, advanced past the field on success.
+ * @param end End of the input.
+ * @param object Receives the value.
+ * @param reason Set to the reason of the failure.
+ * @param buffer Receives string view payloads with escape sequences; nullptr if there is none.
+ * @return true if the field was found.
+ */
+template <typename... Fields>
+template <std::size_t I>
+[[gnu::always_inline]] inline bool
+Schema<Fields...>::scan_field(const char*& it, const char* end, Class& object, Decode_reason& reason,
+                              std::string* buffer) {
+    using Field = std::tuple_element_t<I, std::tuple<Fields...>>;
+    if constexpr (I > 0) {
+        if (!expect_literal(it, end, ",", Decode_reason::EXPECTED_COMMA, reason)) {
+            return false;
+        }
+    }
+    return expect_literal(it, end, Field::key, Decode_reason::EXPECTED_KEY, reason)
+           && expect_literal(it, end, ":", Decode_reason::EXPECTED_COLON, reason)
+           && scan_value(it, end, object.*Field::member, reason, buffer);
+}
+
+/**
+ * @brief Consumes all fields in schema order.
+ * @param it Current position, advanced past the fields on success.
+ * @param end End of the input.
+ * @param object Receives the values.
+ * @param reason Set to the reason of the failure.
+ * @param buffer Receives string view payloads with escape sequences; nullptr if there is none.
+ * @return true if every field was found.
+ */
+template <typename... Fields>
+template <std::size_t... I>
+[[gnu::always_inline]] inline bool
+Schema<Fields...>::scan_fields(const char*& it, const char* end, Class& object, Decode_reason& reason,
+                               std::string* buffer, std::index_sequence<I...>) {
+    return (scan_field<I>(it, end, object, reason, buffer) && ...);
+}
+
+/**
+ * @brief Writes the encoded record to an output iterator.
+ * @tparam OutputIt An output iterator accepting char.
+ * @param object The record to encode.
+ * @param out The iterator to write to.
+ * @return The iterator past the last written character.
+ */
+template <typename... Fields>
+template <typename OutputIt>
+OutputIt
+Schema<Fields...>::encode_to(const Class& object, OutputIt out) {
+    char separator = '{';
+    auto put = [&out, &separator, &object]<typename Field>() {
+        *out++ = separator;
+        out = std::copy(Field::key.begin(), Field::key.end(), out);
+        *out++ = ':';
+        if constexpr (std::unsigned_integral<typename Field::value_type>) {
+            char digits[std::numeric_limits<typename Field::value_type>::digits10 + 1];
+            out = std::copy(digits, std::to_chars(digits, digits + sizeof(digits), object.*Field::member).ptr, out);
+        } else {
+            *out++ = '\'';
+            out = escape_to(object.*Field::member, out);
+            *out++ = '\'';
+        }
+        separator = ',';
+    };
+    (put.template operator()<Fields>(), ...);
+    *out++ = '}';
+    return out;
+}
+
+/**
+ * @brief Returns the length of the encoded record.
+ * @param object The record to measure.
+ * @return The number of characters written by encode_to().
+ */
+template <typename... Fields>
+std::size_t
+Schema<Fields...>::encoded_size(const Class& object) {
+    auto size = [&object]<typename Field>() {
+        // The separator, the quoted key and the colon.
+        std::size_t size = Field::key.size() + 2;
+        if constexpr (std::unsigned_integral<typename Field::value_type>) {
+            size += 1;
+            for (auto rest = object.*Field::member; rest >= 10; rest /= 10) {
+                ++size;
+            }
+        } else {
+            size += escaped_size(object.*Field::member) + 2;
+        }
+        return size;
+    };
+    return (size.template operator()<Fields>() + ... + 1);
+}
+
+/**
+ * @brief Returns an upper bound of the length of the encoded record that does not scan the fields.
+ * @param object The record to measure.
+ * @return A number of characters encode_to() never exceeds.
+ */
+template <typename... Fields>
+std::size_t
+Schema<Fields...>::max_encoded_size(const Class& object) {
+    auto size = [&object]<typename Field>() {
+        std::size_t size = Field::key.size() + 2;
+        if constexpr (std::unsigned_integral<typename Field::value_type>) {
+            size += std::numeric_limits<typename Field::value_type>::digits10 + 1;
+        } else {
+            size += 2 * (object.*Field::member).size() + 2;
+        }
+        return size;
+    };
+    return (size.template operator()<Fields>() + ... + 1);
+}
+
+/**
+ * @brief Parses one record starting at an opening brace.
+ * @param it Position of the opening brace; left at the offending character on failure.
+ * @param end End of the input.
+ * @param object Receives the values.
+ * @param reason Set to the reason of the failure.
+ * @param buffer Receives string view payloads with escape sequences; nullptr if there is none.
+ * @return true if a complete record was parsed.
+ */
+template <typename... Fields>
+[[gnu::always_inline]] inline bool
+Schema<Fields...>::scan(const char*& it, const char* end, Class& object, Decode_reason& reason,
+                        std::string* buffer) {
+    return scan_literal(it, end, "{")
+           && scan_fields(it, end, object, reason, buffer, std::index_sequence_for<Fields...>{})
+           && expect_literal(it, end, "}", Decode_reason::EXPECTED_CLOSING_BRACE, reason);
+}
+
+/**
+ * @brief Finds the first record in the input.
+ *
+ * Every candidate starts at an opening brace, so the scanner only retries from the next brace
+ * when a candidate fails. A well-formed record is therefore parsed in a single pass. If no candidate
+ * succeeds, the error describes the one that got furthest. A candidate with escape sequences and
+ * no buffer stops the search, since the record may well be valid.
+ *
+ * @param begin Start of the input.
+ * @param end End of the input.
+ * @param object Receives the values.
+ * @param error Receives the position and reason of the failure.
+ * @param buffer Cleared and then receives string view payloads with escape sequences; nullptr if there is none.
+ * @return true if a record was found.
+ */
+template <typename... Fields>
+bool
+Schema<Fields...>::find(const char* begin, const char* end, Class& object, Decode_error& error,
+                        std::string* buffer) {
+    if (buffer != nullptr) {
+        buffer->clear();
+    }
+    error = Decode_error{static_cast<std::size_t>(end - begin), Decode_reason::NO_RECORD};
+    const char* furthest = nullptr;
+    for (const char* it = find_char(begin, end, '{'); it != end; it = find_char(it + 1, end, '{')) {
+        const char* cursor = it;
+        Decode_reason reason = Decode_reason::NO_RECORD;
+        if (scan(cursor, end, object, reason, buffer)) {
+            return true;
+        }
+        if (furthest == nullptr || cursor > furthest || reason == Decode_reason::NEEDS_BUFFER) {
+            furthest = cursor;
+            error = Decode_error{static_cast<std::size_t>(cursor - begin), reason};
+        }
+        if (reason == Decode_reason::NEEDS_BUFFER) {
+            return false;
+        }
+        if (buffer != nullptr) {
+            buffer->clear();
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Decodes the first record in a string without throwing.
+ * @param str A string holding the record; text around it is skipped.
+ * @param buffer Cleared and then receives string view payloads with escape sequences; nullptr if there is none.
+ * @return The decoded record, or the position and reason of the failure.
+ */
+template <typename... Fields>
+auto
+Schema<Fields...>::try_decode(std::string_view str, std::string* buffer) -> std::expected<Class, Decode_error> {
+    Class object;
+    Decode_error error;
+    if (!find(str.data(), str.data() + str.size(), object, error, buffer)) {
+        return std::unexpected(error);
+    }
+    return object;
+}
+
+/**
+ * @brief Decodes the first record in a string.
+ * @param str A string holding the record; text around it is skipped.
+ * @param object Receives the values.
+ * @param buffer Cleared and then receives string view payloads with escape sequences; nullptr if there is none.
+ * @throws errors::BAD_JSON if the string holds no record of this schema.
+ */
+template <typename... Fields>
+void
+Schema<Fields...>::decode(std::string_view str, Class& object, std::string* buffer) {
+    Decode_error error;
+    if (!find(str.data(), str.data() + str.size(), object, error, buffer)) {
+        throw BAD_JSON;
+    }
+}
+
+#endif // LAB1_SCHEMA_HPP
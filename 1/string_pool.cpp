@@ -0,0 +1,125 @@
+/**
+ * @file string_pool.cpp
+ * @brief Implementation of the String_pool class.
+ */
+
+#include "string_pool.hpp"
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * @brief Constructs an empty pool.
+ */
+String_pool::String_pool() : offsets{0}, slots(16, 0) {}
+
+/**
+ * @brief Finds the slot holding the string or the empty slot where it belongs.
+ * @param str The string to look for.
+ * @return Index of the slot.
+ */
+std::size_t
+String_pool::probe(std::string_view str) const {
+    std::size_t mask = this->slots.size() - 1;
+    for (std::size_t slot = std::hash<std::string_view>{}(str) & mask;; slot = (slot + 1) & mask) {
+        std::uint32_t entry = this->slots[slot];
+        if (entry == 0 || this->get(entry - 1) == str) {
+            return slot;
+        }
+    }
+}
+
+/**
+ * @brief Doubles the hash table and reinserts all strings.
+ */
+void
+String_pool::grow() {
+    std::vector<std::uint32_t> old(this->slots.size() * 2, 0);
+    old.swap(this->slots);
+    for (std::uint32_t entry : old) {
+        if (entry != 0) {
+            this->slots[this->probe(this->get(entry - 1))] = entry;
+        }
+    }
+}
+
+/**
+ * @brief Adds the string if it is not in the pool yet.
+ *
+ * The table grows and the characters are copied before the string is published in the table, so
+ * the pool is left unchanged if an allocation throws.
+ *
+ * @param str The string to intern.
+ * @return Index of the string in the pool.
+ * @throws std::length_error if the pool already holds 2^32 - 1 strings.
+ */
+std::uint32_t
+String_pool::intern(std::string_view str) {
+    std::size_t slot = this->probe(str);
+    if (this->slots[slot] != 0) {
+        return this->slots[slot] - 1;
+    }
+    if (this->size() == std::numeric_limits<std::uint32_t>::max() - 1) {
+        throw std::length_error("String pool overflow");
+    }
+    if ((this->size() + 1) * 2 > this->slots.size()) {
+        this->grow();
+        slot = this->probe(str);
+    }
+    std::uint32_t index = this->size();
+    this->offsets.push_back(this->arena.size() + str.size());
+    try {
+        this->arena.insert(this->arena.end(), str.begin(), str.end());
+    } catch (...) {
+        this->offsets.pop_back();
+        throw;
+    }
+    this->slots[slot] = index + 1;
+    return index;
+}
+
+/**
+ * @brief Looks up a string without adding it.
+ * @param str The string to look for.
+ * @param index Receives the index of the string if it is found.
+ * @return true if the string is in the pool.
+ */
+bool
+String_pool::find(std::string_view str, std::uint32_t& index) const {
+    std::uint32_t entry = this->slots[this->probe(str)];
+    if (entry == 0) {
+        return false;
+    }
+    index = entry - 1;
+    return true;
+}
+
+/**
+ * @brief Returns the string with the given index.
+ * @param index Index returned by intern().
+ * @return The string.
+ */
+std::string_view
+String_pool::get(std::uint32_t index) const {
+    return std::string_view(this->arena.data() + this->offsets[index],
+                            this->offsets[index + 1] - this->offsets[index]);
+}
+
+/**
+ * @brief Returns the number of distinct strings in the pool.
+ * @return The number of strings.
+ */
+std::size_t
+String_pool::size() const {
+    return this->offsets.size() - 1;
+}
+
+/**
+ * @brief Returns the number of bytes allocated by the pool.
+ * @return The allocated memory in bytes.
+ */
+std::size_t
+String_pool::memory_usage() const {
+    return this->arena.capacity() + this->offsets.capacity() * sizeof(std::size_t)
+           + this->slots.capacity() * sizeof(std::uint32_t);
+}
@@ -0,0 +1,83 @@
+/**
+ * @file string_pool.hpp
+ * @brief Header file for the String_pool class that interns strings in a contiguous arena.
+ */
+
+#ifndef LAB1_STRING_POOL_HPP
+#define LAB1_STRING_POOL_HPP
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class String_pool
+ * @brief Append-only pool that stores every distinct string once and refers to it by index.
+ *
+ * The characters of all strings live in one contiguous arena. Lookup uses an open-addressing hash
+ * table of indices, so an interned string costs its characters plus a few bytes of bookkeeping.
+ */
+class String_pool {
+  private:
+    std::vector<char> arena;          ///< Characters of all strings, back to back.
+    std::vector<std::size_t> offsets; ///< Start of every string in the arena, plus the end of the last one.
+    std::vector<std::uint32_t> slots; ///< Hash table of string index + 1; zero marks an empty slot.
+
+    /**
+     * @brief Finds the slot holding the string or the empty slot where it belongs.
+     * @param str The string to look for.
+     * @return Index of the slot.
+     */
+    std::size_t probe(std::string_view str) const;
+
+    /**
+     * @brief Doubles the hash table and reinserts all strings.
+     */
+    void grow();
+
+  public:
+    /**
+     * @brief Constructs an empty pool.
+     */
+    String_pool();
+
+    /**
+     * @brief Adds the string if it is not in the pool yet.
+     * @param str The string to intern.
+     * @return Index of the string in the pool.
+     * @throws std::length_error if the pool already holds 2^32 - 1 strings.
+     */
+    std::uint32_t intern(std::string_view str);
+
+    /**
+     * @brief Looks up a string without adding it.
+     * @param str The string to look for.
+     * @param index Receives the index of the string if it is found.
+     * @return true if the string is in the pool.
+     */
+    bool find(std::string_view str, std::uint32_t& index) const;
+
+    /**
+     * @brief Returns the string with the given index.
+     *
+     * The view is invalidated by the next call to intern().
+     *
+     * @param index Index returned by intern().
+     * @return The string.
+     */
+    std::string_view get(std::uint32_t index) const;
+
+    /**
+     * @brief Returns the number of distinct strings in the pool.
+     * @return The number of strings.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the number of bytes allocated by the pool.
+     * @return The allocated memory in bytes.
+     */
+    std::size_t memory_usage() const;
+};
+
+#endif // LAB1_STRING_POOL_HPP
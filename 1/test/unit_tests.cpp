@@ -4,7 +4,10 @@
  */
 
 #include <gtest/gtest.h>
+#include <expected>
+#include <sstream>
 #include <string>
+#include <vector>
 #include "../detail.hpp"
 
 using std::string;
@@ -31,6 +34,18 @@ TEST(DetailInfoTest, EncodeWithParametersWorks) {
     EXPECT_EQ(encoded, "{'id':'003','name':'PartB','count':25}");
 }
 
+/**
+ * @test DetailInfoTest.EncodeAllocatesExactSize
+ * @brief Tests that encode() does not keep the capacity reserved for the longest encoding.
+ */
+TEST(DetailInfoTest, EncodeAllocatesExactSize) {
+    Detail_info detail("007", string(1000, 'x'), 5);
+    string encoded = detail.encode();
+
+    EXPECT_EQ(encoded.size(), detail.encoded_size());
+    EXPECT_LT(encoded.capacity(), encoded.size() + 64);
+}
+
 /**
  * @test DetailInfoTest.DecodeFunctionWorks
  * @brief Tests the decode() function with valid input std::string.
@@ -159,3 +174,254 @@ TEST(DetailInfoTest, PrintFunctionWorks) {
 
     EXPECT_EQ(output, "id: 007\nname: PartF\ncount: 200\n");
 }
+
+/**
+ * @test DetailInfoTest.DecodeAllowsWhitespace
+ * @brief Tests that decode() accepts whitespace between tokens.
+ */
+TEST(DetailInfoTest, DecodeAllowsWhitespace) {
+    Detail_info detail;
+    string input = " \t{ 'id' : 'A 1' ,\n'name':\t'Part G' , 'count' : 12 } ";
+
+    detail.decode(input);
+
+    EXPECT_EQ(detail.encode(), "{'id':'A 1','name':'Part G','count':12}");
+}
+
+/**
+ * @test DetailInfoTest.DecodeFindsRecordInsideText
+ * @brief Tests that decode() finds a record surrounded by other text.
+ */
+TEST(DetailInfoTest, DecodeFindsRecordInsideText) {
+    Detail_info detail;
+    string input = "prefix {'id':'{'id':'008','name':'PartH','count':3} suffix";
+
+    detail.decode(input);
+
+    EXPECT_EQ(detail.encode(), "{'id':'008','name':'PartH','count':3}");
+}
+
+/**
+ * @test DetailInfoTest.DecodeFunctionInvalidInput4
+ * @brief Tests the decode() function with truncated and overflowing input.
+ * @throws errors
+ */
+TEST(DetailInfoTest, DecodeFunctionInvalidInput4) {
+    Detail_info detail;
+
+    EXPECT_THROW(detail.decode(string("{'id':'004','name':'PartC','count':75")), errors);
+    EXPECT_THROW(detail.decode(string("{'id':'004','name':'PartC','count':}")), errors);
+    EXPECT_THROW(detail.decode(string("{'id':'004','name':'PartC")), errors);
+    EXPECT_THROW(detail.decode(string("{'id':'004','name':'PartC','count':99999999999999999999999}")), errors);
+    EXPECT_THROW(detail.decode(string("")), errors);
+}
+
+/**
+ * @test DetailInfoTest.DecodeStringViewWorks
+ * @brief Tests the decode() function with a std::string_view into a larger buffer.
+ */
+TEST(DetailInfoTest, DecodeStringViewWorks) {
+    Detail_info detail;
+    string buffer = "{'id':'009','name':'PartI','count':9}{'id':'010','name':'PartJ','count':10}";
+
+    detail.decode(std::string_view(buffer).substr(37));
+
+    EXPECT_EQ(detail.encode(), "{'id':'010','name':'PartJ','count':10}");
+}
+
+/**
+ * @test DetailViewTest.DecodePointsIntoBuffer
+ * @brief Tests that Detail_view::decode() returns fields pointing into the input buffer.
+ */
+TEST(DetailViewTest, DecodePointsIntoBuffer) {
+    string buffer = "{'id':'011','name':'PartK','count':11}";
+    Detail_view view;
+
+    view.decode(buffer);
+
+    EXPECT_EQ(view.id, "011");
+    EXPECT_EQ(view.name, "PartK");
+    EXPECT_EQ(view.count, 11);
+    EXPECT_EQ(view.id.data(), buffer.data() + 7);
+    EXPECT_EQ(Detail_info(view).encode(), buffer);
+}
+
+/**
+ * @test DetailViewTest.DecodeInvalidInput
+ * @brief Tests Detail_view::decode() with invalid input.
+ * @throws errors
+ */
+TEST(DetailViewTest, DecodeInvalidInput) {
+    Detail_view view;
+
+    EXPECT_THROW(view.decode("{'id':'011','name':'PartK'}"), errors);
+}
+
+/**
+ * @test DetailInfoTest.EncodeToStringAppends
+ * @brief Tests that encode_to() appends several records to one string.
+ */
+TEST(DetailInfoTest, EncodeToStringAppends) {
+    Detail_info first("012", "PartL", 0), second("013", "PartM", 18446744073709551615ULL);
+    string out = "[";
+
+    first.encode_to(out);
+    second.encode_to(out);
+
+    EXPECT_EQ(out, "[{'id':'012','name':'PartL','count':0}{'id':'013','name':'PartM','count':18446744073709551615}");
+    EXPECT_EQ(second.encoded_size(), second.encode().size());
+}
+
+/**
+ * @test DetailInfoTest.EncodeToVectorAndIterator
+ * @brief Tests encode_to() with a character vector and an output iterator.
+ */
+TEST(DetailInfoTest, EncodeToVectorAndIterator) {
+    Detail_info detail("014", "PartN", 140);
+    std::vector<char> buffer;
+    std::ostringstream stream;
+
+    detail.encode_to(buffer);
+    detail.encode_to(std::ostreambuf_iterator<char>(stream));
+
+    EXPECT_EQ(string(buffer.begin(), buffer.end()), "{'id':'014','name':'PartN','count':140}");
+    EXPECT_EQ(stream.str(), "{'id':'014','name':'PartN','count':140}");
+}
+
+/**
+ * @test DetailInfoTest.GettersWork
+ * @brief Tests the get_id(), get_name() and get_count() functions.
+ */
+TEST(DetailInfoTest, GettersWork) {
+    Detail_info detail("015", "PartO", 15);
+
+    EXPECT_EQ(detail.get_id(), "015");
+    EXPECT_EQ(detail.get_name(), "PartO");
+    EXPECT_EQ(detail.get_count(), 15);
+}
+
+/**
+ * @test DetailInfoTest.TryDecodeWorks
+ * @brief Tests that try_decode() returns the detail for a well-formed string.
+ */
+TEST(DetailInfoTest, TryDecodeWorks) {
+    std::expected<Detail_info, Decode_error> detail = Detail_info::try_decode("{'id':'016','name':'PartP','count':16}");
+
+    ASSERT_TRUE(detail.has_value());
+    EXPECT_EQ(detail->get_id(), "016");
+    EXPECT_EQ(detail->get_name(), "PartP");
+    EXPECT_EQ(detail->get_count(), 16);
+}
+
+/**
+ * @test DetailInfoTest.TryDecodeReportsErrors
+ * @brief Tests the position and reason reported by try_decode() for malformed strings.
+ */
+TEST(DetailInfoTest, TryDecodeReportsErrors) {
+    const struct {
+        std::string_view input;
+        std::size_t position;
+        Decode_reason reason;
+    } cases[] = {
+        {"no record", 9, Decode_reason::NO_RECORD},
+        {"{'id' '1'}", 6, Decode_reason::EXPECTED_COLON},
+        {"{'id':'1' 'name':'a'}", 10, Decode_reason::EXPECTED_COMMA},
+        {"{'id':'1','nam':'a'}", 10, Decode_reason::EXPECTED_KEY},
+        {"{'id':1}", 6, Decode_reason::EXPECTED_QUOTE},
+        {"{'id':'1','name':'a", 19, Decode_reason::UNTERMINATED_STRING},
+        {"{'id':'1','name':'a','count':x}", 29, Decode_reason::EXPECTED_DIGIT},
+        {"{'id':'1','name':'a','count':99999999999999999999}", 48, Decode_reason::COUNT_OVERFLOW},
+        {"{'id':'1','name':'a','count':1", 30, Decode_reason::EXPECTED_CLOSING_BRACE},
+        {"{'id':'1'} {'id':'1','name':'a'}", 31, Decode_reason::EXPECTED_COMMA},
+    };
+    for (const auto& c : cases) {
+        std::expected<Detail_info, Decode_error> detail = Detail_info::try_decode(c.input);
+
+        ASSERT_FALSE(detail.has_value()) << c.input;
+        EXPECT_EQ(detail.error().position, c.position) << c.input;
+        EXPECT_EQ(detail.error().reason, c.reason) << c.input;
+        EXPECT_FALSE(describe(detail.error().reason).empty());
+    }
+}
+
+/**
+ * @test DetailViewTest.TryDecodeMatchesDecode
+ * @brief Tests that try_decode() finds the same record as decode() in text with several candidates.
+ */
+TEST(DetailViewTest, TryDecodeMatchesDecode) {
+    string input = "{'id':'x' {bad} {'id':'017','name':'PartQ','count':17}";
+    Detail_view view;
+
+    view.decode(input);
+    std::expected<Detail_view, Decode_error> result = Detail_view::try_decode(input);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->id.data(), view.id.data());
+    EXPECT_EQ(result->name, "PartQ");
+    EXPECT_EQ(result->count, 17);
+}
+
+/**
+ * @test DetailInfoTest.EncodeEscapesFields
+ * @brief Tests that quotes, backslashes, tabs, line feeds and carriage returns are escaped by encode().
+ */
+TEST(DetailInfoTest, EncodeEscapesFields) {
+    Detail_info detail("O'Neil\\1", "a\tb\nc\rd", 18);
+
+    EXPECT_EQ(detail.encode(), "{'id':'O\\'Neil\\\\1','name':'a\\tb\\nc\\rd','count':18}");
+    EXPECT_EQ(detail.encoded_size(), detail.encode().size());
+    EXPECT_EQ(escaped_size("'\\"), 4);
+}
+
+/**
+ * @test DetailInfoTest.DecodeUnescapesFields
+ * @brief Tests that decode() reverses the escaping of encode() and accepts UTF-8.
+ */
+TEST(DetailInfoTest, DecodeUnescapesFields) {
+    Detail_info original("O'Neil\\1", "Gr\xc3\xb6\xc3\x9f" "e\n\xe2\x82\xac", 19), decoded;
+
+    decoded.decode(original.encode());
+
+    EXPECT_EQ(decoded.get_id(), original.get_id());
+    EXPECT_EQ(decoded.get_name(), original.get_name());
+    EXPECT_EQ(decoded.get_count(), 19);
+}
+
+/**
+ * @test DetailInfoTest.TryDecodeRejectsBadFields
+ * @brief Tests the errors reported for unsupported escape sequences and malformed UTF-8.
+ */
+TEST(DetailInfoTest, TryDecodeRejectsBadFields) {
+    std::expected<Detail_info, Decode_error> escape = Detail_info::try_decode("{'id':'a\\x','name':'b','count':1}");
+    std::expected<Detail_info, Decode_error> utf8 = Detail_info::try_decode("{'id':'a','name':'b\xc0\xaf','count':1}");
+    std::expected<Detail_info, Decode_error> trailing = Detail_info::try_decode("{'id':'a\\");
+
+    ASSERT_FALSE(escape.has_value());
+    EXPECT_EQ(escape.error().position, 9);
+    EXPECT_EQ(escape.error().reason, Decode_reason::INVALID_ESCAPE);
+    ASSERT_FALSE(utf8.has_value());
+    EXPECT_EQ(utf8.error().position, 19);
+    EXPECT_EQ(utf8.error().reason, Decode_reason::INVALID_UTF8);
+    ASSERT_FALSE(trailing.has_value());
+    EXPECT_EQ(trailing.error().reason, Decode_reason::UNTERMINATED_STRING);
+}
+
+/**
+ * @test DetailViewTest.EscapesNeedBuffer
+ * @brief Tests that views keep plain fields in place and unescape the others into the buffer.
+ */
+TEST(DetailViewTest, EscapesNeedBuffer) {
+    string input = "{'id':'plain','name':'it\\'s','count':20} {'id':'next','name':'x','count':1}";
+    string buffer;
+    Detail_view view;
+
+    std::expected<Detail_view, Decode_error> unbuffered = Detail_view::try_decode(input);
+    view.decode(input, buffer);
+
+    ASSERT_FALSE(unbuffered.has_value());
+    EXPECT_EQ(unbuffered.error().reason, Decode_reason::NEEDS_BUFFER);
+    EXPECT_THROW(Detail_view().decode(input), errors);
+    EXPECT_EQ(view.id.data(), input.data() + 7);
+    EXPECT_EQ(view.name, "it's");
+    EXPECT_EQ(view.name.data(), buffer.data());
+}
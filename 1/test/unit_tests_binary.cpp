@@ -0,0 +1,97 @@
+/**
+ * @file unit_tests_binary.cpp
+ * @brief Unit tests for the binary format of Detail_info using Google Test framework.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include "../detail.hpp"
+
+using std::string;
+
+/**
+ * @test DetailBinaryTest.EncodeLayout
+ * @brief Tests the byte layout produced by encode_binary().
+ */
+TEST(DetailBinaryTest, EncodeLayout) {
+    Detail_info detail("01", "Bolt", 300);
+    string out;
+
+    detail.encode_binary(out);
+
+    EXPECT_EQ(out, string("\x02"
+                          "01"
+                          "\x04"
+                          "Bolt"
+                          "\xac\x02",
+                          10));
+}
+
+/**
+ * @test DetailBinaryTest.RoundTrip
+ * @brief Tests that several concatenated records decode back to the originals.
+ */
+TEST(DetailBinaryTest, RoundTrip) {
+    Detail_info first("016", string(200, 'p'), 0), second("", "", 18446744073709551615ULL);
+    string out;
+    first.encode_binary(out);
+    second.encode_binary(out);
+    Detail_info decoded;
+
+    std::size_t consumed = decoded.decode_binary(out);
+    EXPECT_EQ(decoded.encode(), first.encode());
+    EXPECT_EQ(decoded.decode_binary(std::string_view(out).substr(consumed)), out.size() - consumed);
+    EXPECT_EQ(decoded.encode(), second.encode());
+}
+
+/**
+ * @test DetailBinaryTest.ViewPointsIntoBuffer
+ * @brief Tests that Detail_view::decode_binary() does not copy the fields.
+ */
+TEST(DetailBinaryTest, ViewPointsIntoBuffer) {
+    string out;
+    Detail_info("017", "PartQ", 17).encode_binary(out);
+    Detail_view view;
+
+    view.decode_binary(out);
+
+    EXPECT_EQ(view.id.data(), out.data() + 1);
+    EXPECT_EQ(view.name, "PartQ");
+    EXPECT_EQ(view.count, 17);
+}
+
+/**
+ * @test DetailBinaryTest.DecodeInvalidInput
+ * @brief Tests decode_binary() with truncated and overflowing data.
+ * @throws errors
+ */
+TEST(DetailBinaryTest, DecodeInvalidInput) {
+    string out;
+    Detail_info("018", "PartR", 1000).encode_binary(out);
+    Detail_view view;
+
+    for (std::size_t size = 0; size < out.size(); ++size) {
+        EXPECT_THROW(view.decode_binary(std::string_view(out).substr(0, size)), errors);
+    }
+    EXPECT_EQ(view.decode_binary(string("\x00\x00\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01", 12)), 12);
+    EXPECT_EQ(view.count, 18446744073709551615ULL);
+    EXPECT_THROW(view.decode_binary(string("\x00\x00\xff\xff\xff\xff\xff\xff\xff\xff\xff\x02", 12)), errors);
+    EXPECT_THROW(view.decode_binary(string("\x00\x00\xff\xff\xff\xff\xff\xff\xff\xff\xff\x81\x00", 13)), errors);
+}
+
+/**
+ * @test DetailBinaryTest.ConvertBetweenFormats
+ * @brief Tests text_to_binary() and binary_to_text().
+ */
+TEST(DetailBinaryTest, ConvertBetweenFormats) {
+    string text = "{'id':'019','name':'PartS','count':19}";
+    string binary, back;
+
+    text_to_binary(text, binary);
+    std::size_t consumed = binary_to_text(binary, back);
+
+    EXPECT_EQ(consumed, binary.size());
+    EXPECT_EQ(back, text);
+    EXPECT_LT(binary.size(), text.size());
+    EXPECT_THROW(text_to_binary("{'id':'019'}", binary), errors);
+}
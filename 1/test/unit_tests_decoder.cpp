@@ -0,0 +1,200 @@
+/**
+ * @file unit_tests_decoder.cpp
+ * @brief Unit tests for the Detail_decoder class using Google Test framework.
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+#include "../detail_decoder.hpp"
+
+using std::string;
+
+namespace {
+
+/**
+ * @brief Decodes the input split at the given positions.
+ * @param input The stream to decode.
+ * @param cuts Sorted positions where a new chunk starts.
+ * @return Encoded form of every decoded record.
+ */
+std::vector<string>
+decode_split(const string& input, const std::vector<std::size_t>& cuts) {
+    Detail_decoder decoder;
+    std::vector<string> records;
+    std::size_t begin = 0;
+    auto on_record = [&records](const Detail_view& view) { records.push_back(Detail_info(view).encode()); };
+    for (std::size_t cut : cuts) {
+        decoder.feed(std::string_view(input).substr(begin, cut - begin), on_record);
+        begin = cut;
+    }
+    decoder.feed(std::string_view(input).substr(begin), on_record);
+    return records;
+}
+
+/**
+ * @brief Decodes the input by repeatedly calling the one-shot decoder on what follows the last record.
+ * @param input The stream to decode.
+ * @return Encoded form of every decoded record.
+ */
+std::vector<string>
+decode_reference(const string& input) {
+    std::vector<string> records;
+    std::string_view rest = input;
+    Detail_view view;
+    string buffer;
+    while (true) {
+        try {
+            view.decode(rest, buffer);
+        } catch (errors) {
+            return records;
+        }
+        records.push_back(Detail_info(view).encode());
+        // The record ends where the shortest prefix of the rest that still decodes ends.
+        std::size_t length = 1;
+        while (!Detail_view::try_decode(rest.substr(0, length), buffer)) {
+            ++length;
+        }
+        rest.remove_prefix(length);
+    }
+}
+
+} // namespace
+
+/**
+ * @test DetailDecoderTest.WholeRecords
+ * @brief Tests that records fed in one chunk are all emitted.
+ */
+TEST(DetailDecoderTest, WholeRecords) {
+    Detail_decoder decoder;
+    std::vector<Detail_info> details;
+
+    EXPECT_EQ(decoder.feed("{'id':'001','name':'PartA','count':1}\n{'id':'002','name':'PartB','count':22}", details),
+              2);
+
+    ASSERT_EQ(details.size(), 2);
+    EXPECT_EQ(details[0].encode(), "{'id':'001','name':'PartA','count':1}");
+    EXPECT_EQ(details[1].encode(), "{'id':'002','name':'PartB','count':22}");
+    EXPECT_EQ(decoder.pending_size(), 0);
+}
+
+/**
+ * @test DetailDecoderTest.EveryByteBoundary
+ * @brief Tests that a record split into two chunks at any position is decoded once the brace arrives.
+ */
+TEST(DetailDecoderTest, EveryByteBoundary) {
+    string input = "{ 'id' : 'A-1' , 'name' : 'Bolt' , 'count' : 1234 }";
+    for (std::size_t cut = 0; cut <= input.size(); ++cut) {
+        Detail_decoder decoder;
+        std::vector<Detail_info> details;
+
+        EXPECT_EQ(decoder.feed(input.substr(0, cut), details), cut == input.size() ? 1 : 0);
+        decoder.feed(input.substr(cut), details);
+
+        ASSERT_EQ(details.size(), 1) << "cut at " << cut;
+        EXPECT_EQ(details[0].get_id(), "A-1");
+        EXPECT_EQ(details[0].get_name(), "Bolt");
+        EXPECT_EQ(details[0].get_count(), 1234);
+    }
+}
+
+/**
+ * @test DetailDecoderTest.ByteAtATime
+ * @brief Tests that feeding one byte at a time keeps only the incomplete record buffered.
+ */
+TEST(DetailDecoderTest, ByteAtATime) {
+    string input = "noise{'id':'1','name':'a','count':5}more noise{'id':'2','name':'b','count':6}";
+    Detail_decoder decoder;
+    std::vector<Detail_info> details;
+
+    for (char c : input) {
+        decoder.feed(std::string_view(&c, 1), details);
+    }
+
+    ASSERT_EQ(details.size(), 2);
+    EXPECT_EQ(details[1].encode(), "{'id':'2','name':'b','count':6}");
+    EXPECT_EQ(decoder.pending_size(), 0);
+}
+
+/**
+ * @test DetailDecoderTest.PendingRecord
+ * @brief Tests that an incomplete record is held until it is completed or reset.
+ */
+TEST(DetailDecoderTest, PendingRecord) {
+    Detail_decoder decoder;
+    std::vector<Detail_info> details;
+
+    decoder.feed("{'id':'001','name':'Pa", details);
+    EXPECT_EQ(decoder.pending_size(), 22);
+    decoder.reset();
+    EXPECT_EQ(decoder.pending_size(), 0);
+    decoder.feed("rtA','count':1}", details);
+
+    EXPECT_TRUE(details.empty());
+}
+
+/**
+ * @test DetailDecoderTest.MalformedCandidate
+ * @brief Tests that a record starting inside a malformed candidate is still found.
+ */
+TEST(DetailDecoderTest, MalformedCandidate) {
+    string input = "{'id':'x{'id':'1','name':'a','count':7}{'id':'2','count':1}{'id':'3','name':'c','count':8}";
+
+    EXPECT_EQ(decode_split(input, {}), decode_reference(input));
+    EXPECT_EQ(decode_split(input, {}).size(), 2);
+}
+
+/**
+ * @test DetailDecoderTest.EscapesAcrossChunks
+ * @brief Tests that escape sequences and UTF-8 split between chunks are decoded like in one piece.
+ */
+TEST(DetailDecoderTest, EscapesAcrossChunks) {
+    Detail_info original("it's\\", "caf\xc3\xa9\n", 9);
+    string input = original.encode() + "{'id':'\\q','name':'a','count':1}{'id':'\xc3(','name':'a','count':1}";
+    for (std::size_t cut = 0; cut <= input.size(); ++cut) {
+        std::vector<string> records = decode_split(input, {cut});
+
+        ASSERT_EQ(records.size(), 1) << "cut at " << cut;
+        EXPECT_EQ(records[0], original.encode());
+    }
+}
+
+/**
+ * @test DetailDecoderTest.CountOverflow
+ * @brief Tests that a count that does not fit into std::size_t rejects the record.
+ */
+TEST(DetailDecoderTest, CountOverflow) {
+    Detail_decoder decoder;
+    std::vector<Detail_info> details;
+
+    decoder.feed("{'id':'1','name':'a','count':99999999999999999999}", details);
+
+    EXPECT_TRUE(details.empty());
+    EXPECT_EQ(decoder.pending_size(), 0);
+}
+
+/**
+ * @test DetailDecoderTest.RandomSplits
+ * @brief Tests random streams split at random positions against the one-shot decoder.
+ */
+TEST(DetailDecoderTest, RandomSplits) {
+    const string pieces[] = {"{", "}", "'", ",", ":", " ", "'id'", "'name'", "'count'", "12", "x", "\\", "\\'",
+                             "\\n", "\xc3\xa9", "\xc3", "{'id':'7','name':'n','count':3}",
+                             "{'id':'a\\'b','name':'\\\\','count':4}"};
+    std::mt19937 random(12345);
+    for (int round = 0; round < 500; ++round) {
+        string input;
+        for (int i = 0; i < 40; ++i) {
+            input += pieces[random() % std::size(pieces)];
+        }
+        std::vector<std::size_t> cuts;
+        for (std::size_t i = 1; i < input.size(); ++i) {
+            if (random() % 4 == 0) {
+                cuts.push_back(i);
+            }
+        }
+
+        EXPECT_EQ(decode_split(input, cuts), decode_reference(input)) << input;
+    }
+}
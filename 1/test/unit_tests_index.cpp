@@ -0,0 +1,90 @@
+/**
+ * @file unit_tests_index.cpp
+ * @brief Unit tests for the Detail_index class using Google Test framework.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <type_traits>
+#include "../detail_index.hpp"
+
+using std::string;
+
+/**
+ * @brief Builds a batch of details with ids "a-0" ... "a-99" and "b-0" ... "b-99" interleaved.
+ * @return The batch.
+ */
+static std::vector<Detail_info>
+make_batch() {
+    std::vector<Detail_info> details;
+    for (int i = 0; i < 100; ++i) {
+        details.emplace_back("a-" + std::to_string(i), "Bolt", i);
+        details.emplace_back("b-" + std::to_string(i), "Nut", 100 + i);
+    }
+    return details;
+}
+
+/**
+ * @test DetailIndexTest.FindById
+ * @brief Tests point lookups by id.
+ */
+TEST(DetailIndexTest, FindById) {
+    std::vector<Detail_info> details = make_batch();
+    details.emplace_back("a-5", "Duplicate", 0);
+    Detail_index index(details);
+
+    for (int i = 0; i < 100; ++i) {
+        const Detail_info* found = index.find("b-" + std::to_string(i));
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->get_count(), 100 + i);
+    }
+    EXPECT_EQ(index.find("a-5"), &details[10]);
+    EXPECT_EQ(index.find("c-1"), nullptr);
+
+    std::vector<Detail_info> empty;
+    EXPECT_EQ(Detail_index(empty).find(""), nullptr);
+}
+
+/**
+ * @test DetailIndexTest.RejectsTemporaryBatch
+ * @brief Tests that an index cannot be built over a temporary batch it would outlive.
+ */
+TEST(DetailIndexTest, RejectsTemporaryBatch) {
+    EXPECT_TRUE((std::is_constructible_v<Detail_index, std::vector<Detail_info>&>));
+    EXPECT_FALSE((std::is_constructible_v<Detail_index, std::vector<Detail_info>>));
+    EXPECT_FALSE((std::is_constructible_v<Detail_index, const std::vector<Detail_info>&&, bool>));
+}
+
+/**
+ * @test DetailIndexTest.PrefixQuery
+ * @brief Tests prefix queries on the sorted index.
+ */
+TEST(DetailIndexTest, PrefixQuery) {
+    std::vector<Detail_info> details = make_batch();
+    Detail_index index(details, true);
+
+    auto positions = index.prefix("b-1");
+
+    ASSERT_EQ(positions.size(), 11);
+    EXPECT_EQ(details[positions[0]].get_id(), "b-1");
+    EXPECT_EQ(details[positions[1]].get_id(), "b-10");
+    EXPECT_EQ(details[positions[10]].get_id(), "b-19");
+    EXPECT_EQ(index.prefix("").size(), 200);
+    EXPECT_TRUE(index.prefix("c").empty());
+}
+
+/**
+ * @test DetailIndexTest.RangeQuery
+ * @brief Tests range queries on the sorted index.
+ */
+TEST(DetailIndexTest, RangeQuery) {
+    std::vector<Detail_info> details = make_batch();
+    Detail_index index(details);
+
+    EXPECT_THROW(index.range("a", "b"), std::logic_error);
+    index.build_sorted();
+
+    EXPECT_EQ(index.range("a", "b").size(), 100);
+    EXPECT_EQ(index.range("a-90", "a-95").size(), 5);
+    EXPECT_TRUE(index.range("b", "a").empty());
+}
@@ -0,0 +1,122 @@
+/**
+ * @file unit_tests_parallel.cpp
+ * @brief Unit tests for the multi-threaded decoder using Google Test framework.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "../parallel_decoder.hpp"
+
+using std::string;
+
+/**
+ * @brief Builds newline-delimited input where every seventh line is malformed.
+ * @param lines Number of lines.
+ * @return The input.
+ */
+static string
+make_input(std::size_t lines) {
+    string input;
+    for (std::size_t i = 1; i <= lines; ++i) {
+        if (i % 7 == 0) {
+            input += "broken\n";
+        } else {
+            Detail_info(std::to_string(i), "Part", i).encode_to(input);
+            input += '\n';
+        }
+    }
+    return input;
+}
+
+/**
+ * @test ParallelDecoderTest.MatchesSingleThread
+ * @brief Tests that every thread count yields the records and bad lines in input order.
+ */
+TEST(ParallelDecoderTest, MatchesSingleThread) {
+    string input = make_input(1000);
+    for (unsigned threads : {1u, 2u, 3u, 8u, 64u}) {
+        std::vector<Detail_info> details;
+        std::vector<std::size_t> bad_lines;
+
+        EXPECT_EQ(decode_parallel(input, details, bad_lines, threads), 858);
+
+        ASSERT_EQ(details.size(), 858);
+        ASSERT_EQ(bad_lines.size(), 142);
+        EXPECT_EQ(details[0].get_id(), "1");
+        EXPECT_EQ(details[6].get_id(), "8");
+        EXPECT_EQ(details.back().get_id(), "1000");
+        EXPECT_EQ(bad_lines[0], 7);
+        EXPECT_EQ(bad_lines.back(), 994);
+    }
+}
+
+/**
+ * @test ParallelDecoderTest.ConcurrentCalls
+ * @brief Tests repeated calls from several threads sharing the worker pool.
+ */
+TEST(ParallelDecoderTest, ConcurrentCalls) {
+    string input = make_input(300);
+    std::vector<std::size_t> totals(3);
+    std::vector<std::thread> callers;
+    for (std::size_t caller = 0; caller < totals.size(); ++caller) {
+        callers.emplace_back([&input, &totals, caller] {
+            for (int round = 0; round < 20; ++round) {
+                std::vector<Detail_info> details;
+                std::vector<std::size_t> bad_lines;
+                totals[caller] += decode_parallel(input, details, bad_lines, 2 + round % 4);
+            }
+        });
+    }
+    for (std::thread& caller : callers) {
+        caller.join();
+    }
+
+    for (std::size_t total : totals) {
+        EXPECT_EQ(total, 20 * 258);
+    }
+}
+
+/**
+ * @test ParallelDecoderTest.SmallInput
+ * @brief Tests inputs with fewer lines than threads and without a trailing newline.
+ */
+TEST(ParallelDecoderTest, SmallInput) {
+    std::vector<Detail_info> details;
+    std::vector<std::size_t> bad_lines;
+
+    EXPECT_EQ(decode_parallel("", details, bad_lines, 4), 0);
+    EXPECT_EQ(decode_parallel("x\n{'id':'1','name':'A','count':1}", details, bad_lines, 4), 1);
+
+    EXPECT_EQ(details.size(), 1);
+    EXPECT_EQ(bad_lines, std::vector<std::size_t>{1});
+}
+
+/**
+ * @test ParallelDecoderTest.DecodeFile
+ * @brief Tests decoding a memory-mapped file.
+ */
+TEST(ParallelDecoderTest, DecodeFile) {
+    string path = testing::TempDir() + "parallel_decoder_test.txt";
+    std::ofstream(path) << make_input(100);
+    std::vector<Detail_info> details;
+    std::vector<std::size_t> bad_lines;
+
+    EXPECT_EQ(decode_file(path, details, bad_lines, 3), 86);
+
+    EXPECT_EQ(bad_lines.size(), 14);
+    std::remove(path.c_str());
+}
+
+/**
+ * @test ParallelDecoderTest.MissingFile
+ * @brief Tests decoding a file that does not exist.
+ * @throws std::runtime_error
+ */
+TEST(ParallelDecoderTest, MissingFile) {
+    std::vector<Detail_info> details;
+    std::vector<std::size_t> bad_lines;
+
+    EXPECT_THROW(decode_file("/nonexistent/records.txt", details, bad_lines), std::runtime_error);
+}
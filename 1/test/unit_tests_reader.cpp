@@ -0,0 +1,83 @@
+/**
+ * @file unit_tests_reader.cpp
+ * @brief Unit tests for the Detail_reader class using Google Test framework.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "../detail_reader.hpp"
+
+using std::string;
+
+/**
+ * @test DetailReaderTest.ReadsAllLines
+ * @brief Tests that every line is decoded into the vector.
+ */
+TEST(DetailReaderTest, ReadsAllLines) {
+    std::istringstream in("{'id':'001','name':'PartA','count':1}\n"
+                          "{'id':'002','name':'PartB','count':2}\n"
+                          "{'id':'003','name':'PartC','count':3}");
+    Detail_reader reader(in);
+    std::vector<Detail_info> details;
+    std::vector<std::size_t> bad_lines;
+
+    EXPECT_EQ(reader.read(details, bad_lines), 3);
+
+    ASSERT_EQ(details.size(), 3);
+    EXPECT_EQ(details[0].encode(), "{'id':'001','name':'PartA','count':1}");
+    EXPECT_EQ(details[2].encode(), "{'id':'003','name':'PartC','count':3}");
+    EXPECT_TRUE(bad_lines.empty());
+}
+
+/**
+ * @test DetailReaderTest.ReportsBadLines
+ * @brief Tests that malformed lines are reported by number and skipped.
+ */
+TEST(DetailReaderTest, ReportsBadLines) {
+    std::istringstream in("{'id':'001','name':'PartA','count':1}\n"
+                          "garbage\n"
+                          "\n"
+                          "{'id':'004','name':'PartD','count':4}\n"
+                          "{'id':'005','name':'PartE'}\n");
+    Detail_reader reader(in);
+    std::vector<Detail_info> details;
+    std::vector<std::size_t> bad_lines;
+
+    EXPECT_EQ(reader.read(details, bad_lines), 2);
+
+    EXPECT_EQ(details.size(), 2);
+    EXPECT_EQ(bad_lines, (std::vector<std::size_t>{2, 5}));
+}
+
+/**
+ * @test DetailReaderTest.LinesLongerThanChunk
+ * @brief Tests that lines spanning several chunks are decoded.
+ */
+TEST(DetailReaderTest, LinesLongerThanChunk) {
+    string long_name(100, 'n');
+    std::ostringstream out;
+    for (int i = 0; i < 10; ++i) {
+        out << Detail_info(std::to_string(i), long_name, i).encode() << '\n';
+    }
+    std::istringstream in(out.str());
+    Detail_reader reader(in, 7);
+    std::size_t total = 0;
+
+    std::size_t decoded = reader.read([&total](const Detail_view& view) { total += view.count; },
+                                      [](std::size_t) { FAIL(); });
+
+    EXPECT_EQ(decoded, 10);
+    EXPECT_EQ(total, 45);
+}
+
+/**
+ * @test DetailReaderTest.InvalidChunkSize
+ * @brief Tests the constructor with a zero chunk size.
+ * @throws std::invalid_argument
+ */
+TEST(DetailReaderTest, InvalidChunkSize) {
+    std::istringstream in;
+
+    EXPECT_THROW(Detail_reader reader(in, 0), std::invalid_argument);
+}
@@ -0,0 +1,212 @@
+/**
+ * @file unit_tests_scan.cpp
+ * @brief Unit tests for the character scanning functions using Google Test framework.
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include "../detail.hpp"
+#include "../scan.hpp"
+
+using std::string;
+
+/**
+ * @brief Checks an implementation of find_char() against the scalar reference on fuzzed inputs.
+ * @param impl The implementation to check.
+ */
+static void
+check_against_scalar(const char* (*impl)(const char*, const char*, char)) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> length(0, 200), alphabet(0, 7);
+    const char symbols[] = {'a', 'b', '\'', '{', '}', ':', ',', '\xff'};
+    for (int round = 0; round < 2000; ++round) {
+        string input(length(gen), ' ');
+        for (char& c : input) {
+            c = symbols[alphabet(gen)];
+        }
+        std::size_t offset = input.empty() ? 0 : gen() % input.size();
+        char needle = symbols[alphabet(gen)];
+        const char* first = input.data() + offset;
+        const char* last = input.data() + input.size();
+        ASSERT_EQ(impl(first, last, needle), find_char_scalar(first, last, needle)) << input;
+    }
+}
+
+/**
+ * @test ScanTest.DispatchMatchesScalar
+ * @brief Tests the runtime-selected find_char() against the scalar reference.
+ */
+TEST(ScanTest, DispatchMatchesScalar) { check_against_scalar(find_char); }
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ * @test ScanTest.Sse2MatchesScalar
+ * @brief Tests find_char_sse2() against the scalar reference.
+ */
+TEST(ScanTest, Sse2MatchesScalar) {
+    if (!__builtin_cpu_supports("sse2")) {
+        GTEST_SKIP() << "SSE2 is not supported";
+    }
+    check_against_scalar(find_char_sse2);
+}
+
+/**
+ * @test ScanTest.Avx2MatchesScalar
+ * @brief Tests find_char_avx2() against the scalar reference.
+ */
+TEST(ScanTest, Avx2MatchesScalar) {
+    if (!__builtin_cpu_supports("avx2")) {
+        GTEST_SKIP() << "AVX2 is not supported";
+    }
+    check_against_scalar(find_char_avx2);
+}
+#endif
+
+/**
+ * @brief Builds a fuzzed input of field characters, escapes, control characters and UTF-8 bytes.
+ * @param gen The random generator.
+ * @return The input.
+ */
+static string
+fuzz_field(std::mt19937& gen) {
+    std::uniform_int_distribution<int> length(0, 200), alphabet(0, 31);
+    const char symbols[] = {'\'', '\\', '\t', '\n', '\r', '\xc3', '\xa9', '\xff'};
+    string input(length(gen), ' ');
+    for (char& c : input) {
+        int symbol = alphabet(gen);
+        c = symbol < 8 ? symbols[symbol] : 'a' + symbol;
+    }
+    return input;
+}
+
+/**
+ * @brief Checks an implementation of find_quote_or_escape() against the scalar reference on fuzzed inputs.
+ * @param impl The implementation to check.
+ */
+static void
+check_quote_against_scalar(const char* (*impl)(const char*, const char*, bool&)) {
+    std::mt19937 gen(7);
+    for (int round = 0; round < 2000; ++round) {
+        string input = fuzz_field(gen);
+        std::size_t offset = input.empty() ? 0 : gen() % input.size();
+        const char* first = input.data() + offset;
+        const char* last = input.data() + input.size();
+        bool ascii = true, expected_ascii = true;
+        ASSERT_EQ(impl(first, last, ascii), find_quote_or_escape_scalar(first, last, expected_ascii)) << input;
+        ASSERT_EQ(ascii, expected_ascii) << input;
+    }
+}
+
+/**
+ * @brief Checks an implementation of find_escapable() against the scalar reference on fuzzed inputs.
+ * @param impl The implementation to check.
+ */
+static void
+check_escapable_against_scalar(const char* (*impl)(const char*, const char*)) {
+    std::mt19937 gen(9);
+    for (int round = 0; round < 2000; ++round) {
+        string input = fuzz_field(gen);
+        std::size_t offset = input.empty() ? 0 : gen() % input.size();
+        const char* first = input.data() + offset;
+        const char* last = input.data() + input.size();
+        ASSERT_EQ(impl(first, last), find_escapable_scalar(first, last)) << input;
+    }
+}
+
+/**
+ * @test ScanTest.FieldScansMatchScalar
+ * @brief Tests the runtime-selected find_quote_or_escape() and find_escapable() against the scalar references.
+ */
+TEST(ScanTest, FieldScansMatchScalar) {
+    check_quote_against_scalar(find_quote_or_escape);
+    check_escapable_against_scalar(find_escapable);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ * @test ScanTest.FieldScansSse2MatchScalar
+ * @brief Tests the SSE2 field scans against the scalar references.
+ */
+TEST(ScanTest, FieldScansSse2MatchScalar) {
+    if (!__builtin_cpu_supports("sse2")) {
+        GTEST_SKIP() << "SSE2 is not supported";
+    }
+    check_quote_against_scalar(find_quote_or_escape_sse2);
+    check_escapable_against_scalar(find_escapable_sse2);
+}
+
+/**
+ * @test ScanTest.FieldScansAvx2MatchScalar
+ * @brief Tests the AVX2 field scans against the scalar references.
+ */
+TEST(ScanTest, FieldScansAvx2MatchScalar) {
+    if (!__builtin_cpu_supports("avx2")) {
+        GTEST_SKIP() << "AVX2 is not supported";
+    }
+    check_quote_against_scalar(find_quote_or_escape_avx2);
+    check_escapable_against_scalar(find_escapable_avx2);
+}
+#endif
+
+/**
+ * @test ScanTest.FindInvalidUtf8
+ * @brief Tests find_invalid_utf8() on well-formed and malformed sequences.
+ */
+TEST(ScanTest, FindInvalidUtf8) {
+    const struct {
+        string input;
+        std::size_t invalid;
+    } cases[] = {
+        {"plain", 5},
+        {"caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80", 14},
+        {"\xc0\xaf", 0},         // overlong '/'
+        {"a\xe0\x80\xaf", 1},    // overlong '/'
+        {"\xed\xa0\x80", 0},     // surrogate U+D800
+        {"\xf4\x90\x80\x80", 0}, // above U+10FFFF
+        {"ab\xc3", 2},           // truncated
+        {"\xc3(", 0},            // bad continuation byte
+        {"x\x80", 1},            // stray continuation byte
+        {"\xf5\x80\x80\x80", 0}, // invalid lead byte
+    };
+    for (const auto& c : cases) {
+        const char* first = c.input.data();
+        EXPECT_EQ(find_invalid_utf8(first, first + c.input.size()) - first, c.invalid) << c.input;
+    }
+}
+
+/**
+ * @test ScanTest.DecodeLongFields
+ * @brief Tests decode() with fields longer than one vector register at every alignment.
+ */
+TEST(ScanTest, DecodeLongFields) {
+    for (std::size_t length = 0; length < 100; ++length) {
+        string id(length, 'i'), name(length + 1, 'n');
+        string encoded = Detail_info(id, name, length).encode();
+        Detail_view view;
+
+        view.decode(encoded);
+
+        EXPECT_EQ(view.id, id);
+        EXPECT_EQ(view.name, name);
+        EXPECT_EQ(view.count, length);
+    }
+}
+
+/**
+ * @test ScanTest.EscapedLongFields
+ * @brief Tests the round trip of fields with escapes and UTF-8 at every position around the vector width.
+ */
+TEST(ScanTest, EscapedLongFields) {
+    for (std::size_t length = 0; length < 70; ++length) {
+        string id(length, 'i'), name = string(length, 'n') + "\xc3\xa9'\\\n" + string(length, 'm');
+        string encoded = Detail_info(id, name, length).encode(), buffer;
+        Detail_view view;
+
+        view.decode(encoded, buffer);
+
+        EXPECT_EQ(view.id, id);
+        EXPECT_EQ(view.name, name);
+        EXPECT_EQ(encoded.size(), Detail_info(id, name, length).encoded_size());
+    }
+}
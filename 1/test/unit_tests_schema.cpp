@@ -0,0 +1,159 @@
+/**
+ * @file unit_tests_schema.cpp
+ * @brief Unit tests for the schema-driven codec using Google Test framework.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <expected>
+#include <string>
+#include <string_view>
+#include "../detail.hpp"
+#include "../schema.hpp"
+
+using std::string;
+
+namespace {
+
+/**
+ * @brief Record type with owned strings and a narrow number, described only by its schema.
+ */
+struct Shipment {
+    string code;              ///< Code of the shipment.
+    std::uint16_t boxes = 0;  ///< Number of boxes.
+    string destination;       ///< Destination of the shipment.
+    std::uint64_t weight = 0; ///< Weight in grams.
+};
+
+using Shipment_schema = Schema<Field<"code", &Shipment::code>, Field<"boxes", &Shipment::boxes>,
+                               Field<"to", &Shipment::destination>, Field<"weight", &Shipment::weight>>;
+
+/**
+ * @brief Record type with a single view field.
+ */
+struct Label {
+    std::string_view text; ///< Text of the label.
+};
+
+using Label_schema = Schema<Field<"text", &Label::text>>;
+
+/**
+ * @brief Encodes a shipment into a string.
+ * @param shipment The shipment to encode.
+ * @return The encoded record.
+ */
+string
+encode(const Shipment& shipment) {
+    string out(Shipment_schema::encoded_size(shipment), '\0');
+    Shipment_schema::encode_to(shipment, out.data());
+    return out;
+}
+
+} // namespace
+
+/**
+ * @test SchemaTest.EncodesFieldsInOrder
+ * @brief Tests that fields are written in schema order with strings quoted and escaped.
+ */
+TEST(SchemaTest, EncodesFieldsInOrder) {
+    Shipment shipment{"S-1", 12, "O'Hare", 18446744073709551615u};
+
+    EXPECT_EQ(encode(shipment), "{'code':'S-1','boxes':12,'to':'O\\'Hare','weight':18446744073709551615}");
+    EXPECT_LE(Shipment_schema::encoded_size(shipment), Shipment_schema::max_encoded_size(shipment));
+}
+
+/**
+ * @test SchemaTest.RoundTrip
+ * @brief Tests that an encoded record decodes back into the same values.
+ */
+TEST(SchemaTest, RoundTrip) {
+    Shipment shipment{"tab\there", 65535, "caf\xc3\xa9\\", 0};
+
+    std::expected<Shipment, Decode_error> decoded = Shipment_schema::try_decode(encode(shipment), nullptr);
+
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->code, shipment.code);
+    EXPECT_EQ(decoded->boxes, shipment.boxes);
+    EXPECT_EQ(decoded->destination, shipment.destination);
+    EXPECT_EQ(decoded->weight, shipment.weight);
+}
+
+/**
+ * @test SchemaTest.SkipsWhitespaceAndSurroundingText
+ * @brief Tests that whitespace between tokens and text around the record are accepted.
+ */
+TEST(SchemaTest, SkipsWhitespaceAndSurroundingText) {
+    Shipment shipment;
+
+    Shipment_schema::decode("x{} { 'code' : 'A' , 'boxes' : 3 , 'to' : 'B' , 'weight' : 4 } y", shipment, nullptr);
+
+    EXPECT_EQ(shipment.code, "A");
+    EXPECT_EQ(shipment.boxes, 3);
+    EXPECT_EQ(shipment.destination, "B");
+    EXPECT_EQ(shipment.weight, 4);
+}
+
+/**
+ * @test SchemaTest.ReportsErrors
+ * @brief Tests the position and reason reported for malformed records.
+ */
+TEST(SchemaTest, ReportsErrors) {
+    struct Case {
+        string input;
+        std::size_t position;
+        Decode_reason reason;
+    };
+    const Case cases[] = {
+        {"{'code':'A','to':'B','boxes':1,'weight':2}", 12, Decode_reason::EXPECTED_KEY},
+        {"{'code':'A','boxes':65536,'to':'B','weight':2}", 24, Decode_reason::COUNT_OVERFLOW},
+        {"{'code':'A','boxes':1,'to':'B','weight':2", 41, Decode_reason::EXPECTED_CLOSING_BRACE},
+        {"{'code':'A\\x','boxes':1,'to':'B','weight':2}", 11, Decode_reason::INVALID_ESCAPE},
+    };
+    for (const Case& c : cases) {
+        std::expected<Shipment, Decode_error> decoded = Shipment_schema::try_decode(c.input, nullptr);
+
+        ASSERT_FALSE(decoded.has_value()) << c.input;
+        EXPECT_EQ(decoded.error().position, c.position) << c.input;
+        EXPECT_EQ(decoded.error().reason, c.reason) << c.input;
+    }
+    Shipment shipment;
+    EXPECT_THROW(Shipment_schema::decode("{'code':'A'}", shipment, nullptr), errors);
+}
+
+/**
+ * @test SchemaTest.ViewsNeedBufferForEscapes
+ * @brief Tests that view fields point into the input and escaped ones into the buffer.
+ */
+TEST(SchemaTest, ViewsNeedBufferForEscapes) {
+    string plain = "{'text':'plain'}";
+    string escaped = "{'text':'it\\'s'}";
+    string buffer;
+
+    std::expected<Label, Decode_error> label = Label_schema::try_decode(plain, nullptr);
+    ASSERT_TRUE(label.has_value());
+    EXPECT_EQ(label->text.data(), plain.data() + 9);
+
+    label = Label_schema::try_decode(escaped, nullptr);
+    ASSERT_FALSE(label.has_value());
+    EXPECT_EQ(label.error().reason, Decode_reason::NEEDS_BUFFER);
+
+    label = Label_schema::try_decode(escaped, &buffer);
+    ASSERT_TRUE(label.has_value());
+    EXPECT_EQ(label->text, "it's");
+    EXPECT_EQ(label->text.data(), buffer.data());
+}
+
+/**
+ * @test SchemaTest.DetailSchemaMatchesDetailInfo
+ * @brief Tests that the detail schema produces the same encoding as Detail_info.
+ */
+TEST(SchemaTest, DetailSchemaMatchesDetailInfo) {
+    Detail_info detail("id\n1", "it's", 42);
+    Detail_view view = detail.view();
+    string out(Detail_schema::encoded_size(view), '\0');
+
+    Detail_schema::encode_to(view, out.data());
+
+    EXPECT_EQ(out, detail.encode());
+    EXPECT_EQ(out, "{'id':'id\\n1','name':'it\\'s','count':42}");
+}
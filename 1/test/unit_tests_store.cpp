@@ -0,0 +1,195 @@
+/**
+ * @file unit_tests_store.cpp
+ * @brief Unit tests for the String_pool and Detail_store classes using Google Test framework.
+ */
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include "../detail_store.hpp"
+
+using std::string;
+
+namespace {
+
+/// Number of allocations left before operator new throws; negative means it never throws.
+long allocations_left = -1;
+
+} // namespace
+
+void*
+operator new(std::size_t size) {
+    if (allocations_left == 0) {
+        throw std::bad_alloc();
+    }
+    if (allocations_left > 0) {
+        --allocations_left;
+    }
+    if (void* ptr = std::malloc(size != 0 ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void*
+operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void*
+operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return operator new(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void*
+operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+// Kept out of line, so the compiler does not see free() applied to the result of operator new.
+[[gnu::noinline]] void
+operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void
+operator delete[](void* ptr) noexcept {
+    operator delete(ptr);
+}
+
+void
+operator delete(void* ptr, std::size_t) noexcept {
+    operator delete(ptr);
+}
+
+void
+operator delete[](void* ptr, std::size_t) noexcept {
+    operator delete(ptr);
+}
+
+void
+operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    operator delete(ptr);
+}
+
+void
+operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    operator delete(ptr);
+}
+
+/**
+ * @test StringPoolTest.InternDeduplicates
+ * @brief Tests that equal strings share one index.
+ */
+TEST(StringPoolTest, InternDeduplicates) {
+    String_pool pool;
+
+    std::uint32_t bolt = pool.intern("Bolt");
+    std::uint32_t nut = pool.intern("Nut");
+    std::uint32_t empty = pool.intern("");
+
+    EXPECT_EQ(pool.intern("Bolt"), bolt);
+    EXPECT_EQ(pool.intern(""), empty);
+    EXPECT_NE(bolt, nut);
+    EXPECT_EQ(pool.get(nut), "Nut");
+    EXPECT_EQ(pool.get(empty), "");
+    EXPECT_EQ(pool.size(), 3);
+}
+
+/**
+ * @test StringPoolTest.GrowKeepsIndices
+ * @brief Tests that indices stay valid while the pool grows.
+ */
+TEST(StringPoolTest, GrowKeepsIndices) {
+    String_pool pool;
+
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_EQ(pool.intern("id-" + std::to_string(i)), i);
+    }
+
+    std::uint32_t index = 0;
+    EXPECT_TRUE(pool.find("id-1234", index));
+    EXPECT_EQ(index, 1234);
+    EXPECT_FALSE(pool.find("id-10000", index));
+    EXPECT_EQ(pool.get(9999), "id-9999");
+}
+
+/**
+ * @test DetailStoreTest.AddAndIterate
+ * @brief Tests adding details and iterating over them in insertion order.
+ */
+TEST(DetailStoreTest, AddAndIterate) {
+    Detail_store store;
+    store.add(Detail_info("001", "Bolt", 1).view());
+    store.add(Detail_info("002", "Nut", 2).view());
+    store.add(Detail_info("003", "Bolt", 3).view());
+
+    string encoded;
+    for (const Detail_view& view : store) {
+        view.encode_to(std::back_inserter(encoded));
+    }
+
+    EXPECT_EQ(store.size(), 3);
+    EXPECT_EQ(store.name_count(), 2);
+    EXPECT_EQ(encoded, "{'id':'001','name':'Bolt','count':1}{'id':'002','name':'Nut','count':2}"
+                       "{'id':'003','name':'Bolt','count':3}");
+    EXPECT_THROW(store[3], std::out_of_range);
+}
+
+/**
+ * @test DetailStoreTest.FindById
+ * @brief Tests lookup by id, returning the first detail with that id.
+ */
+TEST(DetailStoreTest, FindById) {
+    Detail_store store;
+    store.add(Detail_info("001", "Bolt", 1).view());
+    store.add(Detail_info("002", "Nut", 2).view());
+    store.add(Detail_info("001", "Screw", 3).view());
+
+    std::optional<Detail_view> found = store.find("001");
+
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found->name, "Bolt");
+    EXPECT_EQ(found->count, 1);
+    EXPECT_EQ(store.find("002")->count, 2);
+    EXPECT_FALSE(store.find("004").has_value());
+}
+
+/**
+ * @test DetailStoreTest.FailedAddKeepsFind
+ * @brief Tests that an add interrupted by a failed allocation at any point leaves find() working.
+ */
+TEST(DetailStoreTest, FailedAddKeepsFind) {
+    for (long allocations = 0;; ++allocations) {
+        Detail_store store;
+        for (int i = 0; i < 7; ++i) {
+            store.add(Detail_info("00" + std::to_string(i), "Part " + std::to_string(i), i).view());
+        }
+        Detail_info added("007", "Washer", 7);
+        bool done = false;
+
+        allocations_left = allocations;
+        try {
+            store.add(added.view());
+            done = true;
+        } catch (const std::bad_alloc&) {
+        }
+        allocations_left = -1;
+
+        ASSERT_EQ(store.size(), done ? 8 : 7);
+        EXPECT_EQ(store.find("003")->name, "Part 3");
+        EXPECT_EQ(store.find("007").has_value(), done);
+        store.add(added.view());
+        store.add(Detail_info("008", "Spring", 8).view());
+        EXPECT_EQ(store.find("007")->name, "Washer");
+        EXPECT_EQ(store.find("008")->count, 8);
+        if (done) {
+            break;
+        }
+    }
+}
@@ -0,0 +1,78 @@
+/**
+ * @file unit_tests_table.cpp
+ * @brief Unit tests for the Detail_table class using Google Test framework.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include "../detail_table.hpp"
+
+using std::string;
+
+/**
+ * @brief Builds a table with three names.
+ * @return The table.
+ */
+static Detail_table
+make_table() {
+    return Detail_table(std::vector<Detail_info>{
+        Detail_info("001", "Bolt", 5), Detail_info("002", "Nut", 7), Detail_info("003", "Bolt", 1),
+        Detail_info("004", "Screw", 7), Detail_info("005", "Nut", 3), Detail_info("006", "Bolt", 9),
+    });
+}
+
+/**
+ * @test DetailTableTest.RowsAndSum
+ * @brief Tests row access and the sum of all counts.
+ */
+TEST(DetailTableTest, RowsAndSum) {
+    Detail_table table = make_table();
+
+    EXPECT_EQ(table.size(), 6);
+    EXPECT_EQ(table.row(3).id, "004");
+    EXPECT_EQ(table.row(3).name, "Screw");
+    EXPECT_EQ(table.row(3).count, 7);
+    EXPECT_EQ(table.sum(), 32);
+    EXPECT_EQ(Detail_table().sum(), 0);
+    EXPECT_THROW(table.row(6), std::out_of_range);
+}
+
+/**
+ * @test DetailTableTest.SumAndFilterByName
+ * @brief Tests the sum and filter by name.
+ */
+TEST(DetailTableTest, SumAndFilterByName) {
+    Detail_table table = make_table();
+
+    EXPECT_EQ(table.sum("Bolt"), 15);
+    EXPECT_EQ(table.sum("Washer"), 0);
+    EXPECT_EQ(table.filter("Nut"), (std::vector<std::size_t>{1, 4}));
+    EXPECT_TRUE(table.filter("Washer").empty());
+}
+
+/**
+ * @test DetailTableTest.GroupByName
+ * @brief Tests the sums grouped by name.
+ */
+TEST(DetailTableTest, GroupByName) {
+    Detail_table table = make_table();
+
+    auto groups = table.group_by_name();
+
+    ASSERT_EQ(groups.size(), 3);
+    EXPECT_EQ(groups[0], std::make_pair(std::string_view("Bolt"), std::size_t(15)));
+    EXPECT_EQ(groups[1], std::make_pair(std::string_view("Nut"), std::size_t(10)));
+    EXPECT_EQ(groups[2], std::make_pair(std::string_view("Screw"), std::size_t(7)));
+}
+
+/**
+ * @test DetailTableTest.TopK
+ * @brief Tests the rows with the largest counts.
+ */
+TEST(DetailTableTest, TopK) {
+    Detail_table table = make_table();
+
+    EXPECT_EQ(table.top_k(3), (std::vector<std::size_t>{5, 1, 3}));
+    EXPECT_EQ(table.top_k(10).size(), 6);
+    EXPECT_TRUE(table.top_k(0).empty());
+}
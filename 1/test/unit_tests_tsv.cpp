@@ -0,0 +1,124 @@
+/**
+ * @file unit_tests_tsv.cpp
+ * @brief Unit tests for the conversion between tab-separated details and encoded records.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "../detail_tsv.hpp"
+
+using std::string;
+
+/**
+ * @test DetailTsvTest.EncodesLines
+ * @brief Tests that every tab-separated line is encoded into one record per line.
+ */
+TEST(DetailTsvTest, EncodesLines) {
+    std::istringstream in("001\tPartA\t1\n002\tPart B\t20\r\n\n003\t\t0");
+    std::ostringstream out;
+
+    EXPECT_EQ(encode_stream(in, out), 0);
+
+    EXPECT_EQ(out.str(), "{'id':'001','name':'PartA','count':1}\n"
+                         "{'id':'002','name':'Part B','count':20}\n"
+                         "{'id':'003','name':'','count':0}\n");
+}
+
+/**
+ * @test DetailTsvTest.DecodesLines
+ * @brief Tests that every encoded record is decoded into one tab-separated line.
+ */
+TEST(DetailTsvTest, DecodesLines) {
+    std::istringstream in("{'id':'001','name':'PartA','count':1}\n\n{'id':'002','name':'Part B','count':20}");
+    std::ostringstream out;
+
+    EXPECT_EQ(decode_stream(in, out), 0);
+
+    EXPECT_EQ(out.str(), "001\tPartA\t1\n002\tPart B\t20\n");
+}
+
+/**
+ * @test DetailTsvTest.EscapedFieldsRoundTrip
+ * @brief Tests that escaped tabs, line breaks and backslashes survive encoding and decoding.
+ */
+TEST(DetailTsvTest, EscapedFieldsRoundTrip) {
+    string tsv = "A\\t1\tna\\\\me\\nx\\ry\t5\n"
+                 "it's\tback\\\\slash\\t\t18446744073709551615\n";
+    std::istringstream in(tsv);
+    std::ostringstream encoded;
+    ASSERT_EQ(encode_stream(in, encoded), 0);
+
+    EXPECT_EQ(encoded.str().substr(0, encoded.str().find('\n')), "{'id':'A\\t1','name':'na\\\\me\\nx\\ry','count':5}");
+
+    std::istringstream encoded_in(encoded.str());
+    std::ostringstream decoded;
+    EXPECT_EQ(decode_stream(encoded_in, decoded), 0);
+    EXPECT_EQ(decoded.str(), tsv);
+}
+
+/**
+ * @test DetailTsvTest.RejectsMalformedLines
+ * @brief Tests that malformed lines are reported by number, skipped and make the result non-zero.
+ */
+TEST(DetailTsvTest, RejectsMalformedLines) {
+    std::istringstream in("001\tPartA\t1\n"
+                          "no tabs\n"
+                          "002\tPartB\n"
+                          "003\tPartC\t-1\n"
+                          "004\tPartD\t7x\n"
+                          "005\tPart\\qE\t1\n"
+                          "006\tPartF\\\t1\n"
+                          "007\tPartG\t\n"
+                          "008\tPartH\t8\n");
+    std::ostringstream out;
+
+    testing::internal::CaptureStderr();
+    int status = encode_stream(in, out);
+    string errors = testing::internal::GetCapturedStderr();
+
+    EXPECT_EQ(status, 1);
+    EXPECT_EQ(out.str(), "{'id':'001','name':'PartA','count':1}\n"
+                         "{'id':'008','name':'PartH','count':8}\n");
+    EXPECT_EQ(errors, "line 2: bad record\nline 3: bad record\nline 4: bad record\nline 5: bad record\n"
+                      "line 6: bad record\nline 7: bad record\nline 8: bad record\n");
+}
+
+/**
+ * @test DetailTsvTest.RejectsMalformedRecords
+ * @brief Tests that malformed encoded records are reported by number, skipped and make the result non-zero.
+ */
+TEST(DetailTsvTest, RejectsMalformedRecords) {
+    std::istringstream in("{'id':'001','name':'PartA','count':1}\n"
+                          "garbage\n"
+                          "{'id':'003','name':'PartC'}\n"
+                          "{'id':'004','name':'PartD','count':4}\n");
+    std::ostringstream out;
+
+    testing::internal::CaptureStderr();
+    int status = decode_stream(in, out);
+    string errors = testing::internal::GetCapturedStderr();
+
+    EXPECT_EQ(status, 1);
+    EXPECT_EQ(out.str(), "001\tPartA\t1\n004\tPartD\t4\n");
+    EXPECT_EQ(errors, "line 2: bad record\nline 3: bad record\n");
+}
+
+/**
+ * @test DetailTsvTest.LargeInputIsWrittenInBlocks
+ * @brief Tests that output longer than one block is written completely.
+ */
+TEST(DetailTsvTest, LargeInputIsWrittenInBlocks) {
+    string tsv;
+    for (int i = 0; i < 5000; ++i) {
+        tsv += std::to_string(i) + "\tPart\\t" + std::to_string(i) + "\t" + std::to_string(i * 3) + "\n";
+    }
+    std::istringstream in(tsv);
+    std::ostringstream encoded;
+    ASSERT_EQ(encode_stream(in, encoded), 0);
+
+    std::istringstream encoded_in(encoded.str());
+    std::ostringstream decoded;
+    EXPECT_EQ(decode_stream(encoded_in, decoded), 0);
+    EXPECT_EQ(decoded.str(), tsv);
+}
@@ -4,9 +4,46 @@
  */
 
 #include "allocator.hpp"
-#include <cmath>
+#include <cstdlib>
 #include <limits>
-#include <string>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+/**
+ * @brief Выделяет неинициализированную память под массив объектов Signals.
+ * 
+ * @param capacity Число элементов.
+ * @return Указатель на выделенную память.
+ * @throws std::bad_alloc Если память не выделена.
+ */
+Signals*
+allocate(int capacity) {
+    auto* buffer = static_cast<Signals*>(std::malloc(sizeof(Signals) * capacity));
+    if (buffer == nullptr) {
+        throw std::bad_alloc();
+    }
+    return buffer;
+}
+
+/**
+ * @brief Разрушает элементы массива и освобождает его память.
+ * 
+ * @param buffer Указатель на массив или nullptr.
+ * @param size Число созданных элементов.
+ */
+void
+deallocate(Signals* buffer, int size) {
+    if (buffer != nullptr) {
+        std::destroy_n(buffer, size);
+        std::free(buffer);
+    }
+}
+
+} // namespace
 
 /**
  * @brief Конструктор Allocator, инициализирующий массив с заданной емкостью.
@@ -20,13 +57,13 @@ Allocator::Allocator(int n) {
     }
     size_ = 0;
     capacity_ = n;
-    buffer_ = new Signals[capacity_];
+    buffer_ = allocate(capacity_);
 }
 
 /**
  * @brief Деструктор, освобождающий выделенную память.
  */
-Allocator::~Allocator() { delete[] buffer_; }
+Allocator::~Allocator() { deallocate(buffer_, size_); }
 
 /**
  * @brief Конструктор копирования, создающий глубокую копию другого объекта Allocator.
@@ -34,8 +71,10 @@ Allocator::~Allocator() { delete[] buffer_; }
  * @param other Другой объект Allocator для копирования.
  */
 Allocator::Allocator(const Allocator& other) : size_(other.size_), capacity_(other.capacity_) {
-    buffer_ = new Signals[capacity_];
-    std::copy(other.buffer_, other.buffer_ + size_, buffer_);
+    if (capacity_ != 0) {
+        buffer_ = allocate(capacity_);
+        std::uninitialized_copy_n(other.buffer_, size_, buffer_);
+    }
 }
 
 /**
@@ -44,9 +83,8 @@ Allocator::Allocator(const Allocator& other) : size_(other.size_), capacity_(oth
  * @param other Другой объект Allocator для перемещения.
  */
 Allocator::Allocator(Allocator&& other) noexcept
-    : size_(other.size_), capacity_(other.capacity_), buffer_(other.buffer_) {
-    other.buffer_ = nullptr;
-}
+    : size_(std::exchange(other.size_, 0)), capacity_(std::exchange(other.capacity_, 0)),
+      buffer_(std::exchange(other.buffer_, nullptr)) {}
 
 /**
  * @brief Оператор присваивания копированием.
@@ -57,12 +95,8 @@ Allocator::Allocator(Allocator&& other) noexcept
 Allocator&
 Allocator::operator=(const Allocator& other) {
     if (this != &other) {
-        Signals* new_buffer_ = new Signals[other.capacity_];
-        capacity_ = other.capacity_;
-        size_ = other.size_;
-        delete[] buffer_;
-        buffer_ = new_buffer_;
-        std::copy(other.buffer_, other.buffer_ + size_, buffer_);
+        Allocator copy(other);
+        *this = std::move(copy);
     }
     return *this;
 }
@@ -82,34 +116,84 @@ Allocator::operator=(Allocator&& other) noexcept {
 }
 
 /**
- * @brief Изменяет размер массива.
+ * @brief Обеспечивает место для n новых элементов.
  * 
- * Если новый размер превышает текущую емкость, выделяет новую память и копирует элементы.
+ * Пустой массив получает ровно n мест. Иначе емкость удваивается, пока не вместит size_ + n
+ * элементов, поэтому последовательное добавление элементов выполняется за амортизированное O(1).
  * 
- * @param n Новый размер массива.
+ * @param n Число добавляемых элементов.
  * @throws std::invalid_argument Если n меньше или равно нулю.
- * @throws std::overflow_error Если новый размер превышает допустимый предел.
+ * @throws std::overflow_error Если новая емкость превышает допустимый предел.
  */
 void
 Allocator::resize(int n) {
-    int new_capacity{}, multiplier{};
     if (n <= 0) {
         throw std::invalid_argument("Invalid argument");
     }
+    if (n <= capacity_ - size_) {
+        return;
+    }
     if (capacity_ == 0) {
-        new_capacity = n;
-    } else {
-        multiplier = std::ceil(double(n + size_) / capacity_);
-        if (capacity_ > std::numeric_limits<int>::max() / multiplier) {
+        reallocate(n);
+        return;
+    }
+    int new_capacity = capacity_;
+    while (new_capacity - size_ < n) {
+        if (new_capacity > std::numeric_limits<int>::max() / 2) {
             throw std::overflow_error("Capacity overflow");
         }
-        new_capacity = capacity_ * multiplier;
+        new_capacity *= 2;
+    }
+    reallocate(new_capacity);
+}
+
+/**
+ * @brief Увеличивает емкость массива ровно до заданной.
+ * 
+ * @param capacity Новая емкость массива; если она не больше текущей, ничего не происходит.
+ * @throws std::invalid_argument Если capacity отрицательна.
+ */
+void
+Allocator::reserve(int capacity) {
+    if (capacity < 0) {
+        throw std::invalid_argument("Invalid argument");
     }
-    if (capacity_ == 0 || multiplier > 1) {
-        Signals* new_buffer_ = new Signals[new_capacity];
-        std::move(buffer_, buffer_ + size_, new_buffer_);
-        delete[] buffer_;
-        buffer_ = new_buffer_;
-        capacity_ = new_capacity;
+    if (capacity > capacity_) {
+        reallocate(capacity);
+    }
+}
+
+/**
+ * @brief Уменьшает емкость массива до числа элементов в нем.
+ * 
+ * Пустой массив освобождает память полностью.
+ */
+void
+Allocator::shrink_to_fit() {
+    if (size_ == 0) {
+        deallocate(buffer_, 0);
+        buffer_ = nullptr;
+        capacity_ = 0;
+    } else if (size_ < capacity_) {
+        reallocate(size_);
+    }
+}
+
+/**
+ * @brief Переносит элементы в область памяти заданной емкости.
+ * 
+ * Signals тривиально копируем, поэтому память перевыделяется через realloc, который может
+ * расширить блок на месте без копирования.
+ * 
+ * @param capacity Новая емкость массива, не меньше числа элементов.
+ * @throws std::bad_alloc Если память не выделена; массив при этом не меняется.
+ */
+void
+Allocator::reallocate(int capacity) {
+    auto* buffer = static_cast<Signals*>(std::realloc(buffer_, sizeof(Signals) * capacity));
+    if (buffer == nullptr) {
+        throw std::bad_alloc();
     }
+    buffer_ = buffer;
+    capacity_ = capacity;
 }
@@ -9,6 +9,7 @@
 #ifndef LAB2_2_ALLOCATOR_HPP
 #define LAB2_2_ALLOCATOR_HPP
 
+#include <type_traits>
 #include "../signal/signal.hpp"
 
 /**
@@ -22,12 +23,19 @@ struct Signals {
     int time;      ///< Время сигнала.
 };
 
+// Ячейки массива выделяются через malloc и realloc и заполняются присваиванием, что допустимо
+// только для тривиально копируемого типа.
+static_assert(std::is_trivially_copyable_v<Signals>, "Signals must be trivially copyable");
+
 /**
  * @class Allocator
  * @brief Класс для управления динамическим массивом объектов Signals.
  *
  * Allocator предоставляет базовые методы для управления массивом сигналов, включая
  * выделение памяти, копирование, перемещение и изменение размера массива.
+ *
+ * Память выделяется без создания элементов: ячейки с индексами от size_ до capacity_
+ * не инициализированы, и элементы в них записываются по мере заполнения.
  */
 class Allocator {
   public:
@@ -74,18 +82,38 @@ class Allocator {
     Allocator& operator=(Allocator&& other) noexcept;
 
     /**
-     * @brief Изменяет размер массива.
+     * @brief Обеспечивает место для n новых элементов.
      * 
-     * Если новый размер больше текущей емкости, выделяется новая память,
-     * а существующие элементы копируются в новую область памяти.
+     * Если места не хватает, емкость удваивается, пока не вместит все элементы,
+     * а существующие элементы переносятся в новую область памяти.
      * 
-     * @param new_size Новый размер массива.
+     * @param n Число добавляемых элементов.
      */
-    void resize(int new_size);
+    void resize(int n);
+
+    /**
+     * @brief Увеличивает емкость массива ровно до заданной.
+     * 
+     * @param capacity Новая емкость массива; если она не больше текущей, ничего не происходит.
+     */
+    void reserve(int capacity);
+
+    /**
+     * @brief Уменьшает емкость массива до числа элементов в нем.
+     */
+    void shrink_to_fit();
 
     int size_ = 0;              ///< Текущий размер массива.
     int capacity_ = 0;          ///< Емкость массива.
     Signals* buffer_ = nullptr; ///< Указатель на динамический массив объектов Signals.
+
+  private:
+    /**
+     * @brief Переносит элементы в область памяти заданной емкости.
+     * 
+     * @param capacity Новая емкость массива, не меньше числа элементов.
+     */
+    void reallocate(int capacity);
 };
 
 #endif // LAB2_2_ALLOCATOR_HPP
@@ -0,0 +1,278 @@
+/**
+ * @file benchmarks.cpp
+ * @brief Замеры производительности Complex_Signal с помощью Google Benchmark.
+ */
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../complex_signal/complex_signal.hpp"
+#include "../complex_signal/complex_signal_bits.hpp"
+#include "../complex_signal/complex_signal_builder.hpp"
+#include "../complex_signal/complex_signal_view.hpp"
+
+/**
+ * @brief Строит строку из случайных нулей и единиц.
+ *
+ * @param length Длина строки.
+ * @return Строка сигнала.
+ */
+static std::string
+random_levels(int length) {
+    std::mt19937 random(1);
+    std::string str(length, '0');
+    for (char& c : str) {
+        c = static_cast<char>('0' + random() % 2);
+    }
+    return str;
+}
+
+/**
+ * @brief Склеивание трассы из коротких сигналов оператором +=.
+ */
+static void
+BM_Append(benchmark::State& state) {
+    Complex_Signal piece("0110");
+    for (auto _ : state) {
+        Complex_Signal trace("1");
+        for (int i = 0; i < state.range(0); ++i) {
+            trace += piece;
+        }
+        benchmark::DoNotOptimize(trace[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Append)->ArgName("pieces")->Arg(64)->Arg(512)->Arg(4096);
+
+/**
+ * @brief Вставка короткого сигнала в середину длинного.
+ */
+static void
+BM_Insert(benchmark::State& state) {
+    Complex_Signal piece("010");
+    for (auto _ : state) {
+        state.PauseTiming();
+        Complex_Signal signal(random_levels(state.range(0)));
+        state.ResumeTiming();
+        for (int i = 0; i < 64; ++i) {
+            signal.insert(piece, state.range(0) / 2);
+        }
+        benchmark::DoNotOptimize(signal[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+
+BENCHMARK(BM_Insert)->ArgName("length")->Arg(1 << 10)->Arg(1 << 16);
+
+/**
+ * @brief Создание сигнала из строки.
+ */
+static void
+BM_Construct(benchmark::State& state) {
+    std::string str = random_levels(state.range(0));
+    for (auto _ : state) {
+        Complex_Signal signal(str);
+        benchmark::DoNotOptimize(signal[0]);
+    }
+    state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+BENCHMARK(BM_Construct)->ArgName("length")->Arg(1 << 10)->Arg(1 << 20);
+
+/**
+ * @brief Инверсия плотного сигнала: серии или упакованные биты.
+ */
+template <typename Representation>
+static void
+BM_Invert(benchmark::State& state) {
+    Representation signal(random_levels(state.range(0)));
+    for (auto _ : state) {
+        ~signal;
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Invert<Complex_Signal>)->ArgName("length")->Arg(1 << 20);
+BENCHMARK(BM_Invert<Complex_Signal_bits>)->ArgName("length")->Arg(1 << 20);
+
+/**
+ * @brief Доступ по случайным позициям плотного сигнала: серии или упакованные биты.
+ */
+template <typename Representation>
+static void
+BM_Index(benchmark::State& state) {
+    Representation signal(random_levels(state.range(0)));
+    std::mt19937 random(2);
+    int mask = state.range(0) - 1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(signal[random() & mask]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Index<Complex_Signal>)->ArgName("length")->Arg(1 << 20);
+BENCHMARK(BM_Index<Complex_Signal_bits>)->ArgName("length")->Arg(1 << 20);
+
+/**
+ * @brief Растяжение плотного сигнала во времени: серии или упакованные биты.
+ */
+template <typename Representation>
+static void
+BM_Multiply(benchmark::State& state) {
+    Representation signal(random_levels(state.range(0)));
+    for (auto _ : state) {
+        Representation result = signal * 3;
+        benchmark::DoNotOptimize(result[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Multiply<Complex_Signal>)->ArgName("length")->Arg(1 << 20);
+BENCHMARK(BM_Multiply<Complex_Signal_bits>)->ArgName("length")->Arg(1 << 20);
+
+/**
+ * @brief Исключающее ИЛИ двух плотных сигналов: слияние серий или упакованные биты.
+ */
+template <typename Representation>
+static void
+BM_Xor(benchmark::State& state) {
+    std::string levels = random_levels(state.range(0));
+    Representation first(levels), second(levels.substr(1) + levels[0]);
+    for (auto _ : state) {
+        Representation result = first ^ second;
+        benchmark::DoNotOptimize(result[0]);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Xor<Complex_Signal>)->ArgName("length")->Arg(1 << 20);
+BENCHMARK(BM_Xor<Complex_Signal_bits>)->ArgName("length")->Arg(1 << 20);
+
+/**
+ * @brief Растяжение, инверсия и доступ по позиции с копированием серий.
+ */
+static void
+BM_Transform(benchmark::State& state) {
+    Complex_Signal signal(random_levels(state.range(0)));
+    for (auto _ : state) {
+        Complex_Signal result = signal * 3;
+        ~result;
+        benchmark::DoNotOptimize(result[state.range(0)]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Transform)->ArgName("length")->Arg(1 << 10)->Arg(1 << 20);
+
+/**
+ * @brief Растяжение, инверсия и доступ по позиции через Complex_Signal_view.
+ */
+static void
+BM_Transform_view(benchmark::State& state) {
+    Complex_Signal signal(random_levels(state.range(0)));
+    for (auto _ : state) {
+        Complex_Signal_view result = Complex_Signal_view(signal) * 3;
+        ~result;
+        benchmark::DoNotOptimize(result[state.range(0)]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_Transform_view)->ArgName("length")->Arg(1 << 10)->Arg(1 << 20);
+
+/**
+ * @brief Строит позиции запросов к сигналу.
+ *
+ * @param length Длительность сигнала.
+ * @param sorted Упорядочить ли позиции.
+ * @return Позиции, по одной на отсчет сигнала.
+ */
+static std::vector<int>
+random_positions(int length, bool sorted) {
+    std::mt19937 random(3);
+    std::vector<int> positions(length);
+    for (int& position : positions) {
+        position = random() % length;
+    }
+    if (sorted) {
+        std::sort(positions.begin(), positions.end());
+    }
+    return positions;
+}
+
+/**
+ * @brief Уровни сигнала в массиве позиций, по вызову operator[] на позицию.
+ */
+static void
+BM_Sample_each(benchmark::State& state) {
+    Complex_Signal signal(random_levels(state.range(0)));
+    std::vector<int> positions = random_positions(state.range(0), state.range(1));
+    std::vector<int> out(positions.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < positions.size(); ++i) {
+            out[i] = signal[positions[i]];
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size());
+}
+
+BENCHMARK(BM_Sample_each)->ArgNames({"length", "sorted"})->Args({1 << 20, 0})->Args({1 << 20, 1});
+
+/**
+ * @brief Уровни сигнала в массиве позиций одним вызовом sample.
+ */
+static void
+BM_Sample(benchmark::State& state) {
+    Complex_Signal signal(random_levels(state.range(0)));
+    std::vector<int> positions = random_positions(state.range(0), state.range(1));
+    std::vector<int> out(positions.size());
+    for (auto _ : state) {
+        signal.sample(positions, out);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * positions.size());
+}
+
+BENCHMARK(BM_Sample)->ArgNames({"length", "sorted"})->Args({1 << 20, 0})->Args({1 << 20, 1});
+
+/**
+ * @brief Чтение сигнала из потока оператором >>.
+ */
+static void
+BM_Read_stream(benchmark::State& state) {
+    std::string str = random_levels(state.range(0));
+    for (auto _ : state) {
+        std::istringstream in(str);
+        Complex_Signal signal;
+        in >> signal;
+        benchmark::DoNotOptimize(signal[0]);
+    }
+    state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+BENCHMARK(BM_Read_stream)->ArgName("length")->Arg(1 << 20);
+
+/**
+ * @brief Чтение сигнала из файла, отображенного в память.
+ */
+static void
+BM_Read_file(benchmark::State& state) {
+    std::string path = "bm_read_file.txt";
+    std::ofstream(path) << random_levels(state.range(0));
+    for (auto _ : state) {
+        Complex_Signal signal = Complex_Signal_builder::read_file(path);
+        benchmark::DoNotOptimize(signal[0]);
+    }
+    std::remove(path.c_str());
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Read_file)->ArgName("length")->Arg(1 << 20);
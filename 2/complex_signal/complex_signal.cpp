@@ -8,7 +8,156 @@
 
 #include "complex_signal.hpp"
 #include <algorithm>
-#include <regex>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <locale>
+#include <stdexcept>
+#include <vector>
+#include "complex_signal_builder.hpp"
+
+namespace {
+
+/**
+ * @brief Возвращает машинное слово, каждый байт которого равен заданному.
+ *
+ * @param byte Значение байта.
+ * @return Слово из восьми копий байта.
+ */
+constexpr std::uint64_t
+broadcast(unsigned char byte) {
+    return 0x0101010101010101ull * byte;
+}
+
+/**
+ * @brief Загружает восемь символов строки в слово так, что первый символ оказывается в младшем байте.
+ *
+ * @param it Указатель на первый символ.
+ * @return Слово с символами.
+ */
+std::uint64_t
+load(const char* it) {
+    std::uint64_t word;
+    std::memcpy(&word, it, sizeof(word));
+    if constexpr (std::endian::native == std::endian::big) {
+        word = std::byteswap(word);
+    }
+    return word;
+}
+
+/**
+ * @brief Находит конец префикса из символов '0' и '1' и считает в нём серии одинаковых символов.
+ *
+ * Строка просматривается по восемь символов: слово проверяется одной маской, а смены уровня
+ * между соседними символами считаются через popcount от XOR слова с самим собой, сдвинутым на символ.
+ *
+ * @param first Указатель на начало строки.
+ * @param last Указатель на конец строки.
+ * @param runs Получает число серий в префиксе.
+ * @return Указатель на первый символ после префикса.
+ */
+const char*
+scan_levels(const char* first, const char* last, std::size_t& runs) {
+    runs = 0;
+    if (first == last || (*first != '0' && *first != '1')) {
+        return first;
+    }
+    const char* it = first;
+    std::uint64_t previous = static_cast<unsigned char>(*first);
+    while (last - it >= 8) {
+        std::uint64_t word = load(it);
+        if (((word & broadcast(0xFE)) ^ broadcast('0')) != 0) {
+            break;
+        }
+        runs += std::popcount((word ^ (word << 8 | previous)) & broadcast(1));
+        previous = word >> 56;
+        it += 8;
+    }
+    for (; it != last && (*it == '0' || *it == '1'); ++it) {
+        runs += static_cast<unsigned char>(*it) != previous;
+        previous = static_cast<unsigned char>(*it);
+    }
+    ++runs;
+    return it;
+}
+
+/**
+ * @brief Находит конец серии символов, равных первому.
+ *
+ * @param it Указатель на первый символ серии.
+ * @param last Указатель на конец строки.
+ * @return Указатель на первый символ, отличный от первого символа серии.
+ */
+const char*
+run_end(const char* it, const char* last) {
+    char level = *it;
+    std::uint64_t same = broadcast(level);
+    while (last - it >= 8) {
+        std::uint64_t difference = load(it) ^ same;
+        if (difference != 0) {
+            return it + std::countr_zero(difference) / 8;
+        }
+        it += 8;
+    }
+    while (it != last && *it == level) {
+        ++it;
+    }
+    return it;
+}
+
+/**
+ * @brief Концы серий в порядке обхода кучи (раскладка Эйтцингера) для поиска по многим случайным позициям.
+ *
+ * Узел k имеет детей 2k и 2k + 1, поэтому первые уровни дерева поиска лежат в нескольких строках кэша,
+ * а строку с узлами через четыре уровня можно запросить заранее.
+ */
+class Eytzinger_layout {
+  public:
+    /**
+     * @brief Раскладывает концы серий массива.
+     *
+     * @param runs Указатель на первую серию.
+     * @param size Число серий.
+     */
+    Eytzinger_layout(const Signals* runs, int size) : times(size + 1), levels(size + 1) {
+        int index = 0;
+        auto place = [&](auto& self, int node) -> void {
+            if (node <= size) {
+                self(self, 2 * node);
+                times[node] = runs[index].time;
+                levels[node] = runs[index++].signal.get_level();
+                self(self, 2 * node + 1);
+            }
+        };
+        place(place, 1);
+    }
+
+    /**
+     * @brief Возвращает уровень серии, содержащей позицию.
+     *
+     * @param position Позиция, меньшая конца последней серии.
+     * @return Уровень сигнала.
+     */
+    int
+    level(int position) const {
+        std::size_t node = 1;
+        while (node < times.size()) {
+            __builtin_prefetch(times.data() + std::min(16 * node, times.size() - 1));
+            node = 2 * node + (times[node] <= position);
+        }
+        // Спуски вправо после искомого узла дописали к номеру единицы, а последний спуск влево — ноль.
+        node >>= std::countr_one(node) + 1;
+        return levels[node];
+    }
+
+  private:
+    std::vector<int> times;           ///< Концы серий; элемент 0 не используется.
+    std::vector<unsigned char> levels; ///< Уровни серий в том же порядке.
+};
+
+} // namespace
 
 /**
  * @brief Конструктор Complex_Signal, создающий сигнал с заданным уровнем и длительностью.
@@ -27,32 +176,30 @@ Complex_Signal::Complex_Signal(int level, int duration) {
 /**
  * @brief Конструктор Complex_Signal, создающий объект из строки сигнала.
  *
+ * Используется префикс строки из нулей и единиц. Первый проход находит его конец и считает серии,
+ * чтобы выделить память под них ровно один раз, второй записывает серии.
+ *
  * @param str Строка, содержащая последовательность сигналов из нулей и единиц.
- * @throws std::invalid_argument если строка содержит недопустимые символы.
+ * @throws std::invalid_argument если строка не начинается с 0 или 1.
+ * @throws std::overflow_error если префикс длиннее максимального значения int.
  */
 Complex_Signal::Complex_Signal(const std::string& str) {
-    std::regex re("(1+|0+)");
-    std::smatch match;
-    if (std::regex_search(str, match, std::regex("^[01]+"))) {
-        std::string valid_part = match.str();
-        std::sregex_iterator search_begin(valid_part.begin(), valid_part.end(), re);
-        std::sregex_iterator search_end;
-        int len = std::distance(search_begin, search_end);
-        signals.resize(len);
-        for (auto it = search_begin; it != search_end; ++it) {
-            std::string match_str = it->str();
-            Signal signal(match_str[0] - '0', match_str.length());
-            signals.buffer_[signals.size_].signal = signal;
-            if (signals.size_ == 0) {
-                signals.buffer_[signals.size_].time = signal.get_duration();
-            } else {
-                signals.buffer_[signals.size_].time = signal.get_duration() + signals.buffer_[signals.size_ - 1].time;
-            }
-            ++signals.size_;
-        }
-    } else {
+    const char* first = str.data();
+    std::size_t runs;
+    const char* last = scan_levels(first, first + str.size(), runs);
+    if (last == first) {
         throw std::invalid_argument("Invalid input string: " + str);
     }
+    if (last - first > std::numeric_limits<int>::max()) {
+        throw std::overflow_error("Signal is too long");
+    }
+    signals.resize(runs);
+    for (const char* it = first; it != last; ++signals.size_) {
+        const char* end = run_end(it, last);
+        signals.buffer_[signals.size_].signal = Signal(*it - '0', end - it);
+        signals.buffer_[signals.size_].time = end - first;
+        it = end;
+    }
 }
 
 /**
@@ -71,6 +218,63 @@ Complex_Signal::operator[](int position) const {
     return signals.buffer_[index].signal.get_level();
 }
 
+/**
+ * @brief Получает уровни сигнала сразу для многих позиций.
+ *
+ * Для позиций, упорядоченных по неубыванию, серии и позиции обходятся одним проходом: поиск
+ * очередной серии продолжается от предыдущей с удваивающимся шагом, поэтому время
+ * O(m log(n / m) + m) и не больше O(n + m). Для неупорядоченных позиций концы серий раскладываются
+ * в порядке Эйтцингера, если запросов не меньше восьмой части серий, иначе каждая позиция ищется
+ * бинарным поиском без ветвлений.
+ *
+ * @param positions Позиции во времени.
+ * @param out Массив для уровней, по одному на позицию.
+ * @throws std::invalid_argument если размеры массивов различаются.
+ * @throws std::out_of_range если одна из позиций недопустима.
+ */
+void
+Complex_Signal::sample(std::span<const int> positions, std::span<int> out) const {
+    if (positions.size() != out.size()) {
+        throw std::invalid_argument("Positions and levels must have the same size");
+    }
+    if (positions.empty()) {
+        return;
+    }
+    int duration = signals.size_ != 0 ? signals.buffer_[signals.size_ - 1].time : 0;
+    auto [min, max] = std::minmax_element(positions.begin(), positions.end());
+    if (*min < 0 || *max >= duration) {
+        throw std::out_of_range("Invalid position: " + std::to_string(*min < 0 ? *min : *max));
+    }
+    if (!std::is_sorted(positions.begin(), positions.end())) {
+        if (positions.size() < static_cast<std::size_t>(signals.size_) / 8) {
+            std::transform(positions.begin(), positions.end(), out.begin(), [this](int position) {
+                return signals.buffer_[branchless_search(position)].signal.get_level();
+            });
+        } else {
+            Eytzinger_layout layout(signals.buffer_, signals.size_);
+            std::transform(positions.begin(), positions.end(), out.begin(),
+                           [&layout](int position) { return layout.level(position); });
+        }
+        return;
+    }
+    const Signals* runs = signals.buffer_;
+    int index = 0;
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        int position = positions[i];
+        if (runs[index].time <= position) {
+            // Серия с позицией лежит в (index + step / 2, index + step]; дальше — бинарный поиск в этом промежутке.
+            int step = 1;
+            while (index + step < signals.size_ && runs[index + step].time <= position) {
+                step *= 2;
+            }
+            index = std::upper_bound(runs + index + step / 2 + 1, runs + std::min(index + step, signals.size_ - 1),
+                                     position, [](int p, const Signals& run) { return p < run.time; })
+                    - runs;
+        }
+        out[i] = runs[index].signal.get_level();
+    }
+}
+
 /**
  * @brief Бинарный поиск позиции сигнала.
  *
@@ -91,6 +295,27 @@ Complex_Signal::bin_search(int position) const {
     return L;
 }
 
+/**
+ * @brief Находит серию, содержащую позицию, бинарным поиском без ветвлений.
+ *
+ * На каждом шаге отбрасывается половина промежутка, а выбор половины компилируется в условное
+ * перемещение, поэтому случайные запросы не вызывают ошибок предсказания переходов.
+ *
+ * @param position Допустимая позиция во времени.
+ * @return Индекс серии.
+ */
+int
+Complex_Signal::branchless_search(int position) const {
+    const Signals* base = signals.buffer_;
+    int length = signals.size_;
+    while (length > 1) {
+        int half = length / 2;
+        base += base[half - 1].time <= position ? half : 0;
+        length -= half;
+    }
+    return static_cast<int>(base - signals.buffer_);
+}
+
 /**
  * @brief Инвертирует все сигналы в Complex_Signal.
  */
@@ -112,22 +337,41 @@ Complex_Signal::operator~() {
 
 /**
  * @brief Оператор += для добавления другого Complex_Signal к текущему.
- * 
+ *
+ * Серии дописываются в конец массива на месте, поэтому добавление k серий стоит амортизированное O(k).
+ * Если последняя серия текущего сигнала и первая серия добавляемого одного уровня, они сливаются в одну.
+ *
  * @param other Другой Complex_Signal для добавления.
  * @return Ссылка на текущий объект после добавления.
+ * @throws std::overflow_error если суммарная длительность превышает максимальное значение int.
  */
 Complex_Signal&
 Complex_Signal::operator+=(const Complex_Signal& other) {
-    Complex_Signal new_signal;
-    new_signal.signals.resize(signals.size_ + other.signals.size_);
-    int duration = signals.buffer_[signals.size_ - 1].time;
-    std::move(signals.buffer_, signals.buffer_ + signals.size_, new_signal.signals.buffer_);
-    std::copy(other.signals.buffer_, other.signals.buffer_ + other.signals.size_,
-              new_signal.signals.buffer_ + signals.size_);
-    new_signal.signals.size_ = signals.size_ + other.signals.size_;
-    std::for_each(new_signal.signals.buffer_ + signals.size_, new_signal.signals.buffer_ + new_signal.signals.size_,
-                  [duration](Signals& signal) { signal.time += duration; });
-    return *this = std::move(new_signal);
+    int count = other.signals.size_;
+    if (count == 0) {
+        return *this;
+    }
+    int size = signals.size_;
+    int duration = size != 0 ? signals.buffer_[size - 1].time : 0;
+    if (duration > std::numeric_limits<int>::max() - other.signals.buffer_[count - 1].time) {
+        throw std::overflow_error("Signal is too long");
+    }
+    int first_duration = other.signals.buffer_[0].signal.get_duration();
+    int level = other.signals.buffer_[0].signal.get_level();
+    int merged = size != 0 && signals.buffer_[size - 1].signal.get_level() == level;
+    if (count > merged) {
+        // При добавлении сигнала к самому себе other.signals.buffer_ указывает на тот же массив и после resize.
+        signals.resize(count - merged);
+        std::copy(other.signals.buffer_ + merged, other.signals.buffer_ + count, signals.buffer_ + size);
+        signals.size_ += count - merged;
+        std::for_each(signals.buffer_ + size, signals.buffer_ + signals.size_,
+                      [duration](Signals& signal) { signal.time += duration; });
+    }
+    if (merged) {
+        signals.buffer_[size - 1].signal.increase(first_duration);
+        signals.buffer_[size - 1].time += first_duration;
+    }
+    return *this;
 }
 
 /**
@@ -206,6 +450,89 @@ Complex_Signal::operator*(int multiplier) {
     return std::move(tmp);
 }
 
+/**
+ * @brief Оператор & для поотсчетного И двух сигналов одной длительности.
+ *
+ * @param other Второй сигнал.
+ * @return Новый Complex_Signal, равный 1 там, где оба сигнала равны 1.
+ * @throws std::invalid_argument если длительности сигналов различаются.
+ */
+Complex_Signal
+Complex_Signal::operator&(const Complex_Signal& other) const {
+    return combine(other, 0b1000);
+}
+
+/**
+ * @brief Оператор | для поотсчетного ИЛИ двух сигналов одной длительности.
+ *
+ * @param other Второй сигнал.
+ * @return Новый Complex_Signal, равный 1 там, где хотя бы один сигнал равен 1.
+ * @throws std::invalid_argument если длительности сигналов различаются.
+ */
+Complex_Signal
+Complex_Signal::operator|(const Complex_Signal& other) const {
+    return combine(other, 0b1110);
+}
+
+/**
+ * @brief Оператор ^ для поотсчетного исключающего ИЛИ двух сигналов одной длительности.
+ *
+ * @param other Второй сигнал.
+ * @return Новый Complex_Signal, равный 1 там, где уровни сигналов различаются.
+ * @throws std::invalid_argument если длительности сигналов различаются.
+ */
+Complex_Signal
+Complex_Signal::operator^(const Complex_Signal& other) const {
+    return combine(other, 0b0110);
+}
+
+/**
+ * @brief Поотсчетно объединяет два сигнала по таблице истинности.
+ *
+ * Массивы серий обходятся одним проходом, как при слиянии отсортированных массивов:
+ * очередная серия результата заканчивается там, где раньше заканчивается текущая серия
+ * одного из сигналов. Соседние серии одного уровня сливаются, поэтому время и число серий
+ * результата не больше суммы чисел серий сигналов.
+ *
+ * @param other Второй сигнал.
+ * @param table Таблица истинности: бит 2 * a + b задает уровень результата для уровней a и b.
+ * @return Новый Complex_Signal.
+ * @throws std::invalid_argument если длительности сигналов различаются.
+ */
+Complex_Signal
+Complex_Signal::combine(const Complex_Signal& other, unsigned table) const {
+    int duration = signals.size_ != 0 ? signals.buffer_[signals.size_ - 1].time : 0;
+    int other_duration = other.signals.size_ != 0 ? other.signals.buffer_[other.signals.size_ - 1].time : 0;
+    if (duration != other_duration) {
+        throw std::invalid_argument("Signals must have the same duration");
+    }
+    Complex_Signal result;
+    if (duration == 0) {
+        return result;
+    }
+    result.signals.resize(signals.size_ + other.signals.size_ - 1);
+    Signals* out = result.signals.buffer_;
+    const Signals* first = signals.buffer_;
+    const Signals* second = other.signals.buffer_;
+    int level = -1;
+    for (int time = 0; time < duration;) {
+        int end = std::min(first->time, second->time);
+        int next = table >> (first->signal.get_level() * 2 + second->signal.get_level()) & 1;
+        if (next == level) {
+            out[-1].signal.increase(end - time);
+            out[-1].time = end;
+        } else {
+            *out++ = Signals{Signal(next, end - time), end};
+            level = next;
+        }
+        first += first->time == end;
+        second += second->time == end;
+        time = end;
+    }
+    result.signals.size_ = static_cast<int>(out - result.signals.buffer_);
+    return result;
+}
+
 /**
  * @brief Форматированный вывод Complex_Signal в выходной поток.
  *
@@ -236,11 +563,43 @@ operator<<(std::wostream& out, const Complex_Signal& signals) {
 
 /**
  * @brief Оператор ввода для Complex_Signal.
+ *
+ * Как и ввод std::string, читает слово до пробельного символа, но не накапливает его целиком:
+ * символы собираются в буфер размера Complex_Signal_builder::CHUNK_SIZE и передаются построителю.
+ * Сигнал изменяется только после чтения всего слова.
+ *
+ * @throws std::invalid_argument если слово не начинается с 0 или 1.
+ * @throws std::overflow_error если длительность сигнала превышает максимальное значение int.
  */
 std::istream&
 operator>>(std::istream& in, Complex_Signal& signals) {
-    std::string str;
-    in >> str;
-    signals = Complex_Signal(str);
+    std::istream::sentry sentry(in);
+    Complex_Signal_builder builder;
+    if (sentry) {
+        const auto& ctype = std::use_facet<std::ctype<char>>(in.getloc());
+        std::streambuf* buf = in.rdbuf();
+        std::string chunk(Complex_Signal_builder::CHUNK_SIZE, '\0');
+        std::size_t size = 0, extracted = 0;
+        for (int c = buf->sgetc();; c = buf->snextc()) {
+            if (c == std::char_traits<char>::eof()) {
+                in.setstate(std::ios_base::eofbit);
+                break;
+            }
+            if (ctype.is(std::ctype_base::space, static_cast<char>(c))) {
+                break;
+            }
+            chunk[size++] = static_cast<char>(c);
+            if (size == chunk.size()) {
+                builder.append(chunk);
+                extracted += size;
+                size = 0;
+            }
+        }
+        builder.append(std::string_view(chunk).substr(0, size));
+        if (extracted + size == 0) {
+            in.setstate(std::ios_base::failbit);
+        }
+    }
+    signals = builder.build();
     return in;
 }
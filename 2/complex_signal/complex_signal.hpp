@@ -9,6 +9,7 @@
 #ifndef LAB2_2_COMPLEX_SIGNAL_HPP
 #define LAB2_2_COMPLEX_SIGNAL_HPP
 
+#include <span>
 #include <string>
 #include "../allocator/allocator.hpp"
 #include "../signal/signal.hpp"
@@ -65,6 +66,8 @@ class Complex_Signal {
     /**
      * @brief Оператор += для добавления другого Complex_Signal к текущему.
      * 
+     * Серии дописываются на месте; граничные серии одного уровня сливаются.
+     * 
      * @param other Другой Complex_Signal для добавления.
      * @return Ссылка на текущий объект после добавления.
      */
@@ -86,6 +89,14 @@ class Complex_Signal {
      */
     int operator[](int position) const;
 
+    /**
+     * @brief Получает уровни сигнала сразу для многих позиций.
+     * 
+     * @param positions Позиции во времени.
+     * @param out Массив для уровней, по одному на позицию.
+     */
+    void sample(std::span<const int> positions, std::span<int> out) const;
+
     /**
      * @brief Форматированный вывод Complex_Signal в выходной поток.
      * 
@@ -101,6 +112,30 @@ class Complex_Signal {
      */
     Complex_Signal operator*(int multiplier);
 
+    /**
+     * @brief Оператор & для поотсчетного И двух сигналов одной длительности.
+     * 
+     * @param other Второй сигнал.
+     * @return Новый Complex_Signal, равный 1 там, где оба сигнала равны 1.
+     */
+    Complex_Signal operator&(const Complex_Signal& other) const;
+
+    /**
+     * @brief Оператор | для поотсчетного ИЛИ двух сигналов одной длительности.
+     * 
+     * @param other Второй сигнал.
+     * @return Новый Complex_Signal, равный 1 там, где хотя бы один сигнал равен 1.
+     */
+    Complex_Signal operator|(const Complex_Signal& other) const;
+
+    /**
+     * @brief Оператор ^ для поотсчетного исключающего ИЛИ двух сигналов одной длительности.
+     * 
+     * @param other Второй сигнал.
+     * @return Новый Complex_Signal, равный 1 там, где уровни сигналов различаются.
+     */
+    Complex_Signal operator^(const Complex_Signal& other) const;
+
     /**
      * @brief Оператор вывода для вывода Complex_Signal в поток.
      * 
@@ -120,6 +155,11 @@ class Complex_Signal {
     friend std::istream& operator>>(std::istream& in, Complex_Signal& signals);
 
   private:
+    friend class Complex_Signal_bits;
+    friend class Complex_Signal_builder;
+    friend class Complex_Signal_tree;
+    friend class Complex_Signal_view;
+
     Allocator signals; ///< Объект Allocator для хранения последовательности сигналов.
 
     /**
@@ -130,6 +170,14 @@ class Complex_Signal {
      */
     int bin_search(int position) const;
 
+    /**
+     * @brief Находит серию, содержащую позицию, бинарным поиском без ветвлений.
+     * 
+     * @param position Допустимая позиция во времени.
+     * @return Индекс серии.
+     */
+    int branchless_search(int position) const;
+
     /**
      * @brief Делит сигнал на части в массиве на основе позиции и размера.
      * 
@@ -139,6 +187,15 @@ class Complex_Signal {
      * @return Новый индекс после разделения.
      */
     int split(int index, int position, int size);
+
+    /**
+     * @brief Поотсчетно объединяет два сигнала по таблице истинности.
+     * 
+     * @param other Второй сигнал.
+     * @param table Таблица истинности: бит 2 * a + b задает уровень результата для уровней a и b.
+     * @return Новый Complex_Signal.
+     */
+    Complex_Signal combine(const Complex_Signal& other, unsigned table) const;
 };
 
 std::wostream& operator<<(std::wostream& out, const Complex_Signal& signals);
@@ -0,0 +1,425 @@
+/**
+ * @file complex_signal_bits.cpp
+ * @brief Реализация класса Complex_Signal_bits на упакованных битах.
+ */
+
+#include "complex_signal_bits.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+
+/**
+ * @brief Число отсчетов в слове.
+ */
+constexpr int WORD_BITS = 64;
+
+/**
+ * @brief Загружает восемь символов строки в слово так, что первый символ оказывается в младшем байте.
+ *
+ * @param it Указатель на первый символ.
+ * @return Слово с символами.
+ */
+std::uint64_t
+load(const char* it) {
+    std::uint64_t word;
+    std::memcpy(&word, it, sizeof(word));
+    if constexpr (std::endian::native == std::endian::big) {
+        word = std::byteswap(word);
+    }
+    return word;
+}
+
+/**
+ * @brief Возвращает число слов для заданного числа отсчетов.
+ *
+ * @param duration Число отсчетов.
+ * @return Число слов.
+ */
+std::size_t
+words_for(int duration) {
+    return (static_cast<std::size_t>(duration) + WORD_BITS - 1) / WORD_BITS;
+}
+
+} // namespace
+
+/**
+ * @brief Конструктор, создающий сигнал из одной серии.
+ *
+ * @param level Уровень сигнала (0 или 1).
+ * @param duration Длительность сигнала.
+ * @throws std::invalid_argument если уровень не 0 и не 1 или длительность отрицательна.
+ */
+Complex_Signal_bits::Complex_Signal_bits(int level, int duration) : duration(Signal(level, duration).get_duration()) {
+    words.assign(words_for(duration), 0);
+    fill(0, duration, level);
+}
+
+/**
+ * @brief Конструктор, создающий сигнал из строки.
+ *
+ * Используется префикс строки из нулей и единиц. Восемь символов проверяются одной маской
+ * и упаковываются в байт одним умножением.
+ *
+ * @param str Строка, представляющая сигнал.
+ * @throws std::invalid_argument если строка не начинается с 0 или 1.
+ * @throws std::overflow_error если префикс длиннее максимального значения int.
+ */
+Complex_Signal_bits::Complex_Signal_bits(const std::string& str) {
+    if (str.empty() || (str[0] != '0' && str[0] != '1')) {
+        throw std::invalid_argument("Invalid input string: " + str);
+    }
+    const char* it = str.data();
+    const char* last = it + str.size();
+    std::size_t length = 0;
+    auto put = [this, &length](std::uint64_t bits, int count) {
+        if (length % WORD_BITS == 0) {
+            words.push_back(0);
+        }
+        words.back() |= bits << length % WORD_BITS;
+        length += count;
+    };
+    words.reserve(str.size() / WORD_BITS + 1);
+    for (; last - it >= 8; it += 8) {
+        std::uint64_t word = load(it);
+        if (((word & 0xFEFEFEFEFEFEFEFEull) ^ 0x3030303030303030ull) != 0) {
+            break;
+        }
+        put((word & 0x0101010101010101ull) * 0x0102040810204080ull >> 56, 8);
+    }
+    for (; it != last && (*it == '0' || *it == '1'); ++it) {
+        put(*it - '0', 1);
+    }
+    if (length > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+        throw std::overflow_error("Signal is too long");
+    }
+    duration = static_cast<int>(length);
+}
+
+/**
+ * @brief Конструктор, упаковывающий серии Complex_Signal.
+ *
+ * @param signal Сигнал с сериями в массиве.
+ */
+Complex_Signal_bits::Complex_Signal_bits(const Complex_Signal& signal) {
+    const Allocator& runs = signal.signals;
+    duration = runs.size_ != 0 ? runs.buffer_[runs.size_ - 1].time : 0;
+    words.assign(words_for(duration), 0);
+    for (int i = 0; i < runs.size_; ++i) {
+        if (runs.buffer_[i].signal.get_level() == 1) {
+            fill(runs.buffer_[i].time - runs.buffer_[i].signal.get_duration(), runs.buffer_[i].time, 1);
+        }
+    }
+}
+
+/**
+ * @brief Преобразует сигнал в Complex_Signal.
+ *
+ * Число серий считается заранее через popcount от XOR каждого слова с самим собой,
+ * сдвинутым на отсчет, поэтому память под серии выделяется один раз.
+ *
+ * @return Сигнал с сериями в массиве.
+ */
+Complex_Signal
+Complex_Signal_bits::to_complex_signal() const {
+    Complex_Signal result;
+    if (duration == 0) {
+        return result;
+    }
+    int runs = 1;
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        std::uint64_t previous = i != 0 ? words[i - 1] >> (WORD_BITS - 1) : words[0] & 1;
+        std::uint64_t changes = words[i] ^ (words[i] << 1 | previous);
+        if (i + 1 == words.size() && duration % WORD_BITS != 0) {
+            changes &= (1ull << duration % WORD_BITS) - 1;
+        }
+        runs += std::popcount(changes);
+    }
+    result.signals.resize(runs);
+    int level = words[0] & 1;
+    for (int position = 0; position < duration; ++result.signals.size_, level ^= 1) {
+        int end = run_end(position, level);
+        result.signals.buffer_[result.signals.size_].signal = Signal(level, end - position);
+        result.signals.buffer_[result.signals.size_].time = end;
+        position = end;
+    }
+    return result;
+}
+
+/**
+ * @brief Проверяет, занимает ли упакованное представление сигнала меньше памяти, чем серии.
+ *
+ * @param signal Сигнал с сериями в массиве.
+ * @return true, если упакованное представление компактнее.
+ */
+bool
+Complex_Signal_bits::is_cheaper(const Complex_Signal& signal) {
+    const Allocator& runs = signal.signals;
+    int length = runs.size_ != 0 ? runs.buffer_[runs.size_ - 1].time : 0;
+    return words_for(length) * sizeof(std::uint64_t) < runs.size_ * sizeof(Signals);
+}
+
+/**
+ * @brief Возвращает длительность сигнала.
+ *
+ * @return Длительность сигнала.
+ */
+int
+Complex_Signal_bits::get_duration() const {
+    return duration;
+}
+
+/**
+ * @brief Возвращает число отсчетов с уровнем 1.
+ *
+ * @return Число отсчетов с уровнем 1.
+ */
+int
+Complex_Signal_bits::count() const {
+    return std::accumulate(words.begin(), words.end(), 0,
+                           [](int sum, std::uint64_t word) { return sum + std::popcount(word); });
+}
+
+/**
+ * @brief Инвертирует уровни всех отсчетов, по слову за операцию.
+ */
+void
+Complex_Signal_bits::inversion() {
+    for (std::uint64_t& word : words) {
+        word = ~word;
+    }
+    if (duration % WORD_BITS != 0) {
+        words.back() &= (1ull << duration % WORD_BITS) - 1;
+    }
+}
+
+/**
+ * @brief Оператор инверсии ~ для инверсии всех отсчетов.
+ *
+ * @return Ссылка на инвертированный сигнал.
+ */
+Complex_Signal_bits&
+Complex_Signal_bits::operator~() {
+    inversion();
+    return *this;
+}
+
+/**
+ * @brief Оператор [] для получения уровня сигнала в заданной позиции за O(1).
+ *
+ * @param position Позиция сигнала.
+ * @return Уровень сигнала (0 или 1).
+ * @throws std::out_of_range если позиция недопустима.
+ */
+int
+Complex_Signal_bits::operator[](int position) const {
+    if (position < 0 || position >= duration) {
+        throw std::out_of_range("Invalid position: " + std::to_string(position));
+    }
+    return words[position / WORD_BITS] >> position % WORD_BITS & 1;
+}
+
+/**
+ * @brief Оператор * для растяжения сигнала во времени, как у Complex_Signal.
+ *
+ * При множителе до 8 каждый байт исходного сигнала растягивается по таблице из 256 слов
+ * и записывается в результат одним-двумя OR. При большем множителе каждая серия единиц
+ * записывается заполнением слов целиком, и время пропорционально числу серий и числу слов результата.
+ *
+ * @param multiplier Во сколько раз удлиняется каждая серия.
+ * @return Новый сигнал.
+ * @throws std::invalid_argument если multiplier отрицателен.
+ * @throws std::overflow_error если длительность результата превышает максимальное значение int.
+ */
+Complex_Signal_bits
+Complex_Signal_bits::operator*(int multiplier) const {
+    if (multiplier < 0) {
+        throw std::invalid_argument("Multiply value must be a non-negative integer");
+    }
+    if (multiplier > 1 && duration > std::numeric_limits<int>::max() / multiplier) {
+        throw std::overflow_error("Signal is too long");
+    }
+    if (multiplier == 1) {
+        return *this;
+    }
+    Complex_Signal_bits result;
+    result.duration = duration * multiplier;
+    result.words.assign(words_for(result.duration), 0);
+    if (multiplier == 0) {
+        return result;
+    }
+    if (multiplier <= 8) {
+        std::uint64_t spread[256] = {};
+        for (int byte = 1; byte < 256; ++byte) {
+            for (int bit = 0; bit < 8; ++bit) {
+                if ((byte >> bit & 1) != 0) {
+                    spread[byte] |= (~0ull >> (WORD_BITS - multiplier)) << bit * multiplier;
+                }
+            }
+        }
+        std::size_t width = 8 * multiplier;
+        for (std::size_t k = 0; k < words.size() * 8; ++k) {
+            unsigned byte = words[k / 8] >> k % 8 * 8 & 0xFF;
+            if (byte == 0) {
+                continue;
+            }
+            std::size_t bit = k * width;
+            result.words[bit / WORD_BITS] |= spread[byte] << bit % WORD_BITS;
+            if (bit % WORD_BITS != 0) {
+                std::uint64_t high = spread[byte] >> (WORD_BITS - bit % WORD_BITS);
+                if (high != 0) {
+                    result.words[bit / WORD_BITS + 1] |= high;
+                }
+            }
+        }
+        return result;
+    }
+    for (int position = duration != 0 ? run_end(0, 0) : 0; position < duration;) {
+        int end = run_end(position, 1);
+        result.fill(position * multiplier, end * multiplier, 1);
+        position = end < duration ? run_end(end, 0) : end;
+    }
+    return result;
+}
+
+/**
+ * @brief Оператор & для поотсчетного И двух сигналов одной длительности, по 64 отсчета за операцию.
+ *
+ * @param other Второй сигнал.
+ * @return Новый сигнал.
+ * @throws std::invalid_argument если длительности сигналов различаются.
+ */
+Complex_Signal_bits
+Complex_Signal_bits::operator&(const Complex_Signal_bits& other) const {
+    return combine(other, std::bit_and<>());
+}
+
+/**
+ * @brief Оператор | для поотсчетного ИЛИ двух сигналов одной длительности, по 64 отсчета за операцию.
+ *
+ * @param other Второй сигнал.
+ * @return Новый сигнал.
+ * @throws std::invalid_argument если длительности сигналов различаются.
+ */
+Complex_Signal_bits
+Complex_Signal_bits::operator|(const Complex_Signal_bits& other) const {
+    return combine(other, std::bit_or<>());
+}
+
+/**
+ * @brief Оператор ^ для поотсчетного исключающего ИЛИ двух сигналов одной длительности, по 64 отсчета за операцию.
+ *
+ * @param other Второй сигнал.
+ * @return Новый сигнал.
+ * @throws std::invalid_argument если длительности сигналов различаются.
+ */
+Complex_Signal_bits
+Complex_Signal_bits::operator^(const Complex_Signal_bits& other) const {
+    return combine(other, std::bit_xor<>());
+}
+
+/**
+ * @brief Форматированный вывод сигнала в выходной поток.
+ *
+ * Вывод совпадает с выводом сигнала, полученного to_complex_signal().
+ *
+ * @param out Поток для вывода.
+ */
+void
+Complex_Signal_bits::format_print(std::wostream& out) const {
+    int level = duration != 0 ? words[0] & 1 : 0;
+    for (int position = 0; position < duration; level ^= 1) {
+        int end = run_end(position, level);
+        if (position != 0) {
+            out << (level == 1 ? L'/' : L'\\');
+        }
+        Signal(level, end - position).format_print(out);
+        position = end;
+    }
+}
+
+/**
+ * @brief Устанавливает уровень отсчетов в полуинтервале позиций.
+ *
+ * @param first Первая позиция.
+ * @param last Позиция за последней.
+ * @param level Уровень (0 или 1).
+ */
+void
+Complex_Signal_bits::fill(int first, int last, int level) {
+    if (first >= last) {
+        return;
+    }
+    std::size_t first_word = first / WORD_BITS;
+    std::size_t last_word = (last - 1) / WORD_BITS;
+    std::uint64_t first_mask = ~0ull << first % WORD_BITS;
+    std::uint64_t last_mask = ~0ull >> (WORD_BITS - 1 - (last - 1) % WORD_BITS);
+    auto apply = [level](std::uint64_t& word, std::uint64_t mask) { word = level == 1 ? word | mask : word & ~mask; };
+    if (first_word == last_word) {
+        apply(words[first_word], first_mask & last_mask);
+        return;
+    }
+    apply(words[first_word], first_mask);
+    std::fill(words.begin() + first_word + 1, words.begin() + last_word, level == 1 ? ~0ull : 0);
+    apply(words[last_word], last_mask);
+}
+
+/**
+ * @brief Находит первый отсчет другого уровня, начиная с позиции.
+ *
+ * Слова сравниваются с уровнем серии целиком, а позиция смены уровня находится через countr_zero.
+ *
+ * @param position Позиция, с которой начинается поиск.
+ * @param level Уровень серии.
+ * @return Позиция первого отсчета другого уровня или длительность сигнала.
+ */
+int
+Complex_Signal_bits::run_end(int position, int level) const {
+    std::size_t index = position / WORD_BITS;
+    std::uint64_t flip = level == 1 ? ~0ull : 0;
+    std::uint64_t changes = (words[index] ^ flip) & ~0ull << position % WORD_BITS;
+    while (changes == 0) {
+        if (++index == words.size()) {
+            return duration;
+        }
+        changes = words[index] ^ flip;
+    }
+    return std::min(static_cast<int>(index * WORD_BITS) + std::countr_zero(changes), duration);
+}
+
+/**
+ * @brief Пословно объединяет два сигнала одной длительности.
+ *
+ * Операция не должна давать единицы из двух нулей, иначе биты за концом сигнала перестанут быть нулевыми.
+ *
+ * @param other Второй сигнал.
+ * @param operation Операция над парой слов.
+ * @return Новый сигнал.
+ * @throws std::invalid_argument если длительности сигналов различаются.
+ */
+template <typename Operation>
+Complex_Signal_bits
+Complex_Signal_bits::combine(const Complex_Signal_bits& other, Operation operation) const {
+    if (duration != other.duration) {
+        throw std::invalid_argument("Signals must have the same duration");
+    }
+    Complex_Signal_bits result;
+    result.duration = duration;
+    result.words.resize(words.size());
+    std::transform(words.begin(), words.end(), other.words.begin(), result.words.begin(), operation);
+    return result;
+}
+
+/**
+ * @brief Оператор вывода для Complex_Signal_bits.
+ */
+std::wostream&
+operator<<(std::wostream& out, const Complex_Signal_bits& signals) {
+    signals.format_print(out);
+    return out;
+}
@@ -0,0 +1,187 @@
+/**
+ * @file complex_signal_bits.hpp
+ * @brief Определение класса Complex_Signal_bits — сложного сигнала, хранящего по биту на единицу времени.
+ *
+ * Для часто переключающихся сигналов серии из Complex_Signal занимают по 12 байт на отсчет,
+ * а упакованное представление — один бит, и инверсия, доступ по позиции и повторение
+ * выполняются операциями над машинными словами.
+ */
+
+#ifndef LAB2_2_COMPLEX_SIGNAL_BITS_HPP
+#define LAB2_2_COMPLEX_SIGNAL_BITS_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "complex_signal.hpp"
+
+/**
+ * @class Complex_Signal_bits
+ * @brief Сложный сигнал, хранящий уровень каждой единицы времени в отдельном бите.
+ *
+ * Отсчет с позицией i хранится в бите i % 64 слова i / 64. Биты последнего слова за концом
+ * сигнала всегда равны нулю. Выбрать более компактное из двух представлений помогает is_cheaper().
+ */
+class Complex_Signal_bits {
+  public:
+    /**
+     * @brief Конструктор по умолчанию. Создает пустой сигнал.
+     */
+    Complex_Signal_bits() = default;
+
+    /**
+     * @brief Конструктор, создающий сигнал из одной серии.
+     *
+     * @param level Уровень сигнала (0 или 1).
+     * @param duration Длительность сигнала.
+     */
+    Complex_Signal_bits(int level, int duration);
+
+    /**
+     * @brief Конструктор, создающий сигнал из строки.
+     *
+     * @param str Строка, представляющая сигнал.
+     */
+    Complex_Signal_bits(const std::string& str);
+
+    /**
+     * @brief Конструктор, упаковывающий серии Complex_Signal.
+     *
+     * @param signal Сигнал с сериями в массиве.
+     */
+    explicit Complex_Signal_bits(const Complex_Signal& signal);
+
+    /**
+     * @brief Преобразует сигнал в Complex_Signal.
+     *
+     * @return Сигнал с сериями в массиве.
+     */
+    Complex_Signal to_complex_signal() const;
+
+    /**
+     * @brief Проверяет, занимает ли упакованное представление сигнала меньше памяти, чем серии.
+     *
+     * @param signal Сигнал с сериями в массиве.
+     * @return true, если упакованное представление компактнее.
+     */
+    static bool is_cheaper(const Complex_Signal& signal);
+
+    /**
+     * @brief Возвращает длительность сигнала.
+     *
+     * @return Длительность сигнала.
+     */
+    int get_duration() const;
+
+    /**
+     * @brief Возвращает число отсчетов с уровнем 1.
+     *
+     * @return Число отсчетов с уровнем 1.
+     */
+    int count() const;
+
+    /**
+     * @brief Инвертирует уровни всех отсчетов.
+     */
+    void inversion();
+
+    /**
+     * @brief Оператор инверсии ~ для инверсии всех отсчетов.
+     *
+     * @return Ссылка на инвертированный сигнал.
+     */
+    Complex_Signal_bits& operator~();
+
+    /**
+     * @brief Оператор [] для доступа к уровню сигнала на указанной позиции.
+     *
+     * @param position Позиция во времени.
+     * @return Уровень сигнала на данной позиции.
+     */
+    int operator[](int position) const;
+
+    /**
+     * @brief Оператор * для растяжения сигнала во времени, как у Complex_Signal.
+     *
+     * @param multiplier Во сколько раз удлиняется каждая серия.
+     * @return Новый сигнал.
+     */
+    Complex_Signal_bits operator*(int multiplier) const;
+
+    /**
+     * @brief Оператор & для поотсчетного И двух сигналов одной длительности.
+     *
+     * @param other Второй сигнал.
+     * @return Новый сигнал.
+     */
+    Complex_Signal_bits operator&(const Complex_Signal_bits& other) const;
+
+    /**
+     * @brief Оператор | для поотсчетного ИЛИ двух сигналов одной длительности.
+     *
+     * @param other Второй сигнал.
+     * @return Новый сигнал.
+     */
+    Complex_Signal_bits operator|(const Complex_Signal_bits& other) const;
+
+    /**
+     * @brief Оператор ^ для поотсчетного исключающего ИЛИ двух сигналов одной длительности.
+     *
+     * @param other Второй сигнал.
+     * @return Новый сигнал.
+     */
+    Complex_Signal_bits operator^(const Complex_Signal_bits& other) const;
+
+    /**
+     * @brief Форматированный вывод сигнала в выходной поток.
+     *
+     * @param out Поток для вывода.
+     */
+    void format_print(std::wostream& out) const;
+
+    /**
+     * @brief Оператор вывода для вывода сигнала в поток.
+     *
+     * @param out Поток вывода.
+     * @param signals Сигнал для вывода.
+     * @return Поток после вывода сигнала.
+     */
+    friend std::wostream& operator<<(std::wostream& out, const Complex_Signal_bits& signals);
+
+  private:
+    std::vector<std::uint64_t> words; ///< Упакованные отсчеты, по 64 в слове.
+    int duration = 0;                 ///< Длительность сигнала.
+
+    /**
+     * @brief Устанавливает уровень отсчетов в полуинтервале позиций.
+     *
+     * @param first Первая позиция.
+     * @param last Позиция за последней.
+     * @param level Уровень (0 или 1).
+     */
+    void fill(int first, int last, int level);
+
+    /**
+     * @brief Находит первый отсчет другого уровня, начиная с позиции.
+     *
+     * @param position Позиция, с которой начинается поиск; меньше длительности сигнала.
+     * @param level Уровень серии.
+     * @return Позиция первого отсчета другого уровня или длительность сигнала.
+     */
+    int run_end(int position, int level) const;
+
+    /**
+     * @brief Пословно объединяет два сигнала одной длительности.
+     *
+     * @param other Второй сигнал.
+     * @param operation Операция над парой слов.
+     * @return Новый сигнал.
+     */
+    template <typename Operation>
+    Complex_Signal_bits combine(const Complex_Signal_bits& other, Operation operation) const;
+};
+
+std::wostream& operator<<(std::wostream& out, const Complex_Signal_bits& signals);
+
+#endif // LAB2_2_COMPLEX_SIGNAL_BITS_HPP
@@ -0,0 +1,173 @@
+/**
+ * @file complex_signal_builder.cpp
+ * @brief Реализация класса Complex_Signal_builder.
+ */
+
+#include "complex_signal_builder.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+/**
+ * @brief Размер окна файла, после разбора которого его страницы освобождаются.
+ */
+constexpr std::size_t WINDOW_SIZE = 16 * Complex_Signal_builder::CHUNK_SIZE;
+
+/**
+ * @brief Отображение файла в память только для чтения, снимаемое в деструкторе.
+ */
+class Mapped_file {
+  public:
+    /**
+     * @brief Отображает весь файл в память.
+     *
+     * @param path Путь к файлу.
+     * @throws std::runtime_error если файл не удается открыть или отобразить.
+     */
+    Mapped_file(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw std::runtime_error("Failed to open file: " + std::string(strerror(errno)));
+        }
+        struct stat st;
+        if (fstat(fd, &st) == -1) {
+            int error = errno;
+            close(fd);
+            throw std::runtime_error("Failed to stat file: " + std::string(strerror(error)));
+        }
+        size = st.st_size;
+        if (size != 0) {
+            data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                int error = errno;
+                close(fd);
+                throw std::runtime_error("Failed to map file: " + std::string(strerror(error)));
+            }
+            madvise(data, size, MADV_SEQUENTIAL);
+        }
+        close(fd);
+    }
+
+    Mapped_file(const Mapped_file&) = delete;
+    Mapped_file& operator=(const Mapped_file&) = delete;
+
+    /**
+     * @brief Снимает отображение файла.
+     */
+    ~Mapped_file() {
+        if (size != 0) {
+            munmap(data, size);
+        }
+    }
+
+    /**
+     * @brief Возвращает содержимое файла.
+     *
+     * @return Отображенные байты.
+     */
+    std::string_view view() const { return std::string_view(static_cast<const char*>(data), size); }
+
+    /**
+     * @brief Освобождает страницы уже разобранной части файла.
+     *
+     * @param offset Начало части, кратное размеру страницы.
+     * @param length Длина части.
+     */
+    void release(std::size_t offset, std::size_t length) const {
+        madvise(static_cast<char*>(data) + offset, length, MADV_DONTNEED);
+    }
+
+  private:
+    void* data = nullptr; ///< Начало отображения.
+    std::size_t size = 0; ///< Размер отображения.
+};
+
+} // namespace
+
+/**
+ * @brief Дописывает уровни из очередного куска строки.
+ *
+ * Кусок разбирается частями не длиннее CHUNK_SIZE конструктором из строки, и их серии дописываются
+ * оператором +=, который сливает серии одного уровня на границе. Дополнительная память ограничена
+ * одной частью и ее сериями.
+ *
+ * @param chunk Кусок строки сигнала.
+ * @throws std::overflow_error если длительность сигнала превышает максимальное значение int.
+ */
+void
+Complex_Signal_builder::append(std::string_view chunk) {
+    while (!stopped && !chunk.empty()) {
+        std::string_view piece = chunk.substr(0, CHUNK_SIZE);
+        chunk.remove_prefix(piece.size());
+        if (piece[0] != '0' && piece[0] != '1') {
+            stopped = true;
+            return;
+        }
+        buffer.assign(piece);
+        Complex_Signal part(buffer);
+        std::size_t length = part.signals.buffer_[part.signals.size_ - 1].time;
+        signal += part;
+        stopped = length < piece.size();
+    }
+}
+
+/**
+ * @brief Проверяет, встретился ли символ, отличный от 0 и 1.
+ *
+ * @return true, если префикс сигнала закончился.
+ */
+bool
+Complex_Signal_builder::done() const {
+    return stopped;
+}
+
+/**
+ * @brief Возвращает построенный сигнал и начинает новый.
+ *
+ * @return Сигнал из прочитанного префикса.
+ * @throws std::invalid_argument если строка не начиналась с 0 или 1.
+ */
+Complex_Signal
+Complex_Signal_builder::build() {
+    Complex_Signal result = std::move(signal);
+    signal = Complex_Signal();
+    stopped = false;
+    if (result.signals.size_ == 0) {
+        throw std::invalid_argument("Invalid input string");
+    }
+    return result;
+}
+
+/**
+ * @brief Читает сигнал из файла, отображенного в память.
+ *
+ * Пробельные символы в начале файла пропускаются. Файл разбирается окнами, и страницы каждого
+ * разобранного окна сразу освобождаются, поэтому память процесса не растет с размером файла.
+ *
+ * @param path Путь к файлу.
+ * @return Сигнал из первого слова файла.
+ * @throws std::runtime_error если файл не удается открыть или отобразить.
+ * @throws std::invalid_argument если первое слово файла не начинается с 0 или 1.
+ * @throws std::overflow_error если длительность сигнала превышает максимальное значение int.
+ */
+Complex_Signal
+Complex_Signal_builder::read_file(const std::string& path) {
+    Mapped_file file(path);
+    std::string_view data = file.view();
+    Complex_Signal_builder builder;
+    std::size_t first = std::min(data.find_first_not_of(" \t\n\v\f\r"), data.size());
+    for (std::size_t offset = first / WINDOW_SIZE * WINDOW_SIZE; offset < data.size() && !builder.done();
+         offset += WINDOW_SIZE) {
+        std::size_t begin = std::max(offset, first);
+        builder.append(data.substr(begin, offset + WINDOW_SIZE - begin));
+        file.release(offset, std::min(WINDOW_SIZE, data.size() - offset));
+    }
+    return builder.build();
+}
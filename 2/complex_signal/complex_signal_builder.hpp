@@ -0,0 +1,66 @@
+/**
+ * @file complex_signal_builder.hpp
+ * @brief Определение класса Complex_Signal_builder для чтения сигнала по частям.
+ *
+ * Complex_Signal_builder принимает строку сигнала кусками и сразу дописывает их серии в Complex_Signal,
+ * поэтому сигнал из потока или файла любой длины читается с ограниченным буфером, а не через строку целиком.
+ */
+
+#ifndef LAB2_2_COMPLEX_SIGNAL_BUILDER_HPP
+#define LAB2_2_COMPLEX_SIGNAL_BUILDER_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "complex_signal.hpp"
+
+/**
+ * @class Complex_Signal_builder
+ * @brief Построитель Complex_Signal из последовательности кусков строки.
+ *
+ * Как и конструктор из строки, построитель использует префикс из нулей и единиц: после первого
+ * другого символа остальные куски пропускаются.
+ */
+class Complex_Signal_builder {
+  public:
+    /**
+     * @brief Размер куска, который разбирается за один раз.
+     */
+    static constexpr std::size_t CHUNK_SIZE = 1 << 16;
+
+    /**
+     * @brief Дописывает уровни из очередного куска строки.
+     *
+     * @param chunk Кусок строки сигнала.
+     */
+    void append(std::string_view chunk);
+
+    /**
+     * @brief Проверяет, встретился ли символ, отличный от 0 и 1.
+     *
+     * @return true, если префикс сигнала закончился.
+     */
+    bool done() const;
+
+    /**
+     * @brief Возвращает построенный сигнал и начинает новый.
+     *
+     * @return Сигнал из прочитанного префикса.
+     */
+    Complex_Signal build();
+
+    /**
+     * @brief Читает сигнал из файла, отображенного в память.
+     *
+     * @param path Путь к файлу.
+     * @return Сигнал из первого слова файла.
+     */
+    static Complex_Signal read_file(const std::string& path);
+
+  private:
+    Complex_Signal signal; ///< Сигнал из уже прочитанных кусков.
+    std::string buffer;    ///< Копия разбираемого куска.
+    bool stopped = false;  ///< true, если префикс сигнала закончился.
+};
+
+#endif // LAB2_2_COMPLEX_SIGNAL_BUILDER_HPP
@@ -0,0 +1,365 @@
+/**
+ * @file complex_signal_tree.cpp
+ * @brief Реализация класса Complex_Signal_tree на неявном декартовом дереве.
+ */
+
+#include "complex_signal_tree.hpp"
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Генератор приоритетов узлов.
+ */
+thread_local std::minstd_rand priorities;
+
+} // namespace
+
+/**
+ * @brief Конструктор, создающий сигнал из одной серии.
+ *
+ * @param level Уровень сигнала (0 или 1).
+ * @param duration Длительность сигнала.
+ */
+Complex_Signal_tree::Complex_Signal_tree(int level, int duration) : root(make_node(Signal(level, duration))) {}
+
+/**
+ * @brief Конструктор, создающий дерево из серий Complex_Signal за линейное время.
+ *
+ * @param signal Сигнал с сериями в массиве.
+ */
+Complex_Signal_tree::Complex_Signal_tree(const Complex_Signal& signal)
+    : root(build(signal.signals.buffer_, signal.signals.buffer_ + signal.signals.size_)) {}
+
+/**
+ * @brief Конструктор копирования, создающий глубокую копию дерева.
+ *
+ * @param other Сигнал для копирования.
+ */
+Complex_Signal_tree::Complex_Signal_tree(const Complex_Signal_tree& other) : root(copy(other.root)) {}
+
+/**
+ * @brief Оператор присваивания копированием.
+ *
+ * @param other Сигнал для копирования.
+ * @return Ссылка на текущий объект после присваивания.
+ */
+Complex_Signal_tree&
+Complex_Signal_tree::operator=(const Complex_Signal_tree& other) {
+    if (this != &other) {
+        root = copy(other.root);
+    }
+    return *this;
+}
+
+/**
+ * @brief Преобразует дерево в Complex_Signal с теми же сериями.
+ *
+ * @return Сигнал с сериями в массиве.
+ */
+Complex_Signal
+Complex_Signal_tree::to_complex_signal() const {
+    std::vector<Signal> runs;
+    auto visit = [&runs](auto& self, const Node* node) -> void {
+        if (node != nullptr) {
+            self(self, node->left.get());
+            runs.push_back(node->signal);
+            self(self, node->right.get());
+        }
+    };
+    visit(visit, root.get());
+    Complex_Signal result;
+    if (runs.empty()) {
+        return result;
+    }
+    result.signals.resize(runs.size());
+    int time = 0;
+    for (const Signal& signal : runs) {
+        time += signal.get_duration();
+        result.signals.buffer_[result.signals.size_].signal = signal;
+        result.signals.buffer_[result.signals.size_].time = time;
+        ++result.signals.size_;
+    }
+    return result;
+}
+
+/**
+ * @brief Возвращает суммарную длительность сигнала.
+ *
+ * @return Длительность сигнала.
+ */
+int
+Complex_Signal_tree::get_duration() const {
+    return total(root);
+}
+
+/**
+ * @brief Оператор += для добавления другого сигнала в конец текущего.
+ *
+ * @param other Сигнал для добавления.
+ * @return Ссылка на текущий объект после добавления.
+ * @throws std::overflow_error если суммарная длительность превышает максимальное значение int.
+ */
+Complex_Signal_tree&
+Complex_Signal_tree::operator+=(const Complex_Signal_tree& other) {
+    if (total(root) > std::numeric_limits<int>::max() - total(other.root)) {
+        throw std::overflow_error("Signal is too long");
+    }
+    // Копия снимается до перемещения root: при добавлении дерева к самому себе other.root и есть root.
+    std::unique_ptr<Node> tail = copy(other.root);
+    root = merge(std::move(root), std::move(tail));
+    return *this;
+}
+
+/**
+ * @brief Вставляет копию другого сигнала на указанную позицию.
+ *
+ * @param other Сигнал для вставки.
+ * @param position Позиция вставки.
+ * @throws std::out_of_range если позиция недопустима.
+ * @throws std::overflow_error если суммарная длительность превышает максимальное значение int.
+ */
+void
+Complex_Signal_tree::insert(const Complex_Signal_tree& other, int position) {
+    insert(Complex_Signal_tree(other), position);
+}
+
+/**
+ * @brief Вставляет другой сигнал на указанную позицию, забирая его серии.
+ *
+ * Дерево разрезается на позиции, и три части сливаются за O(log n).
+ *
+ * @param other Сигнал для вставки; после вызова пуст.
+ * @param position Позиция вставки.
+ * @throws std::out_of_range если позиция недопустима.
+ * @throws std::overflow_error если суммарная длительность превышает максимальное значение int.
+ */
+void
+Complex_Signal_tree::insert(Complex_Signal_tree&& other, int position) {
+    if (position < 0 || position >= total(root)) {
+        throw std::out_of_range("Invalid position: " + std::to_string(position));
+    }
+    if (total(root) > std::numeric_limits<int>::max() - total(other.root)) {
+        throw std::overflow_error("Signal is too long");
+    }
+    auto [left, right] = cut(std::move(root), position);
+    root = merge(merge(std::move(left), std::move(other.root)), std::move(right));
+}
+
+/**
+ * @brief Разрезает сигнал на указанной позиции за O(log n).
+ *
+ * @param position Позиция разреза.
+ * @return Часть сигнала, начинающаяся с позиции; в текущем объекте остается часть до нее.
+ * @throws std::out_of_range если позиция недопустима.
+ */
+Complex_Signal_tree
+Complex_Signal_tree::split(int position) {
+    if (position < 0 || position > total(root)) {
+        throw std::out_of_range("Invalid position: " + std::to_string(position));
+    }
+    auto [left, right] = cut(std::move(root), position);
+    root = std::move(left);
+    Complex_Signal_tree result;
+    result.root = std::move(right);
+    return result;
+}
+
+/**
+ * @brief Оператор [] для получения уровня сигнала в заданной позиции за O(log n).
+ *
+ * @param position Позиция сигнала.
+ * @return Уровень сигнала (0 или 1).
+ * @throws std::out_of_range если позиция недопустима.
+ */
+int
+Complex_Signal_tree::operator[](int position) const {
+    if (position < 0 || position >= total(root)) {
+        throw std::out_of_range("Invalid position: " + std::to_string(position));
+    }
+    const Node* node = root.get();
+    while (true) {
+        int left_total = total(node->left);
+        if (position < left_total) {
+            node = node->left.get();
+        } else if (position < left_total + node->signal.get_duration()) {
+            return node->signal.get_level();
+        } else {
+            position -= left_total + node->signal.get_duration();
+            node = node->right.get();
+        }
+    }
+}
+
+/**
+ * @brief Форматированный вывод сигнала в выходной поток.
+ *
+ * Вывод совпадает с выводом Complex_Signal с теми же сериями.
+ *
+ * @param out Поток для вывода.
+ */
+void
+Complex_Signal_tree::format_print(std::wostream& out) const {
+    int last_level = -1;
+    auto visit = [&out, &last_level](auto& self, const Node* node) -> void {
+        if (node == nullptr) {
+            return;
+        }
+        self(self, node->left.get());
+        switch (last_level) {
+            case -1: break;
+            case 0: out << L'/'; break;
+            case 1: out << L'\\'; break;
+        }
+        last_level = node->signal.get_level();
+        node->signal.format_print(out);
+        self(self, node->right.get());
+    };
+    visit(visit, root.get());
+}
+
+/**
+ * @brief Создает узел из одной серии со случайным приоритетом.
+ *
+ * @param signal Серия сигнала.
+ * @return Новый узел.
+ */
+std::unique_ptr<Complex_Signal_tree::Node>
+Complex_Signal_tree::make_node(const Signal& signal) {
+    return std::make_unique<Node>(Node{signal, signal.get_duration(), static_cast<unsigned>(priorities()), {}, {}});
+}
+
+/**
+ * @brief Возвращает суммарную длительность поддерева.
+ *
+ * @param node Корень поддерева или nullptr.
+ * @return Суммарная длительность.
+ */
+int
+Complex_Signal_tree::total(const std::unique_ptr<Node>& node) {
+    return node ? node->total : 0;
+}
+
+/**
+ * @brief Пересчитывает суммарную длительность узла по детям.
+ *
+ * @param node Узел для пересчета.
+ */
+void
+Complex_Signal_tree::update(Node& node) {
+    node.total = total(node.left) + node.signal.get_duration() + total(node.right);
+}
+
+/**
+ * @brief Сливает два дерева, все серии первого из которых раньше серий второго.
+ *
+ * @param left Дерево с ранними сериями.
+ * @param right Дерево с поздними сериями.
+ * @return Корень объединенного дерева.
+ */
+std::unique_ptr<Complex_Signal_tree::Node>
+Complex_Signal_tree::merge(std::unique_ptr<Node> left, std::unique_ptr<Node> right) {
+    if (!left || !right) {
+        return left ? std::move(left) : std::move(right);
+    }
+    if (left->priority >= right->priority) {
+        left->right = merge(std::move(left->right), std::move(right));
+        update(*left);
+        return left;
+    }
+    right->left = merge(std::move(left), std::move(right->left));
+    update(*right);
+    return right;
+}
+
+/**
+ * @brief Разрезает дерево по позиции, разделяя серию, которая ее накрывает.
+ *
+ * Правая половина разделенной серии становится новым узлом и первой серией правого дерева.
+ *
+ * @param node Корень дерева.
+ * @param position Длительность левой части.
+ * @return Деревья с сериями до позиции и после нее.
+ */
+std::pair<std::unique_ptr<Complex_Signal_tree::Node>, std::unique_ptr<Complex_Signal_tree::Node>>
+Complex_Signal_tree::cut(std::unique_ptr<Node> node, int position) {
+    if (!node) {
+        return {};
+    }
+    int left_total = total(node->left);
+    int duration = node->signal.get_duration();
+    if (position <= left_total) {
+        auto [left, right] = cut(std::move(node->left), position);
+        node->left = std::move(right);
+        update(*node);
+        return {std::move(left), std::move(node)};
+    }
+    if (position >= left_total + duration) {
+        auto [left, right] = cut(std::move(node->right), position - left_total - duration);
+        node->right = std::move(left);
+        update(*node);
+        return {std::move(node), std::move(right)};
+    }
+    int remains = position - left_total;
+    std::unique_ptr<Node> piece = make_node(Signal(node->signal.get_level(), duration - remains));
+    node->signal.set_duration(remains);
+    std::unique_ptr<Node> right = std::move(node->right);
+    update(*node);
+    return {std::move(node), merge(std::move(piece), std::move(right))};
+}
+
+/**
+ * @brief Копирует поддерево.
+ *
+ * @param node Корень поддерева или nullptr.
+ * @return Корень копии.
+ */
+std::unique_ptr<Complex_Signal_tree::Node>
+Complex_Signal_tree::copy(const std::unique_ptr<Node>& node) {
+    if (!node) {
+        return nullptr;
+    }
+    return std::make_unique<Node>(Node{node->signal, node->total, node->priority, copy(node->left), copy(node->right)});
+}
+
+/**
+ * @brief Строит сбалансированное дерево из серий массива.
+ *
+ * Корнем становится средняя серия, а приоритет узла поднимается до наибольшего из приоритетов детей,
+ * чтобы дерево оставалось кучей по приоритетам.
+ *
+ * @param first Указатель на первую серию.
+ * @param last Указатель за последнюю серию.
+ * @return Корень дерева.
+ */
+std::unique_ptr<Complex_Signal_tree::Node>
+Complex_Signal_tree::build(const Signals* first, const Signals* last) {
+    if (first == last) {
+        return nullptr;
+    }
+    const Signals* middle = first + (last - first) / 2;
+    std::unique_ptr<Node> node = make_node(middle->signal);
+    node->left = build(first, middle);
+    node->right = build(middle + 1, last);
+    for (const std::unique_ptr<Node>* child : {&node->left, &node->right}) {
+        if (*child) {
+            node->priority = std::max(node->priority, (*child)->priority);
+        }
+    }
+    update(*node);
+    return node;
+}
+
+/**
+ * @brief Оператор вывода для Complex_Signal_tree.
+ */
+std::wostream&
+operator<<(std::wostream& out, const Complex_Signal_tree& signals) {
+    signals.format_print(out);
+    return out;
+}
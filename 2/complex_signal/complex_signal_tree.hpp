@@ -0,0 +1,202 @@
+/**
+ * @file complex_signal_tree.hpp
+ * @brief Определение класса Complex_Signal_tree — сложного сигнала, хранящего серии в декартовом дереве.
+ *
+ * Complex_Signal_tree хранит ту же последовательность серий, что и Complex_Signal, но в неявном
+ * декартовом дереве по суммарной длительности, поэтому вставка, разрезание и доступ по позиции
+ * выполняются за O(log n) вместо сдвига массива.
+ */
+
+#ifndef LAB2_2_COMPLEX_SIGNAL_TREE_HPP
+#define LAB2_2_COMPLEX_SIGNAL_TREE_HPP
+
+#include <memory>
+#include <ostream>
+#include <utility>
+#include "complex_signal.hpp"
+
+/**
+ * @class Complex_Signal_tree
+ * @brief Сложный сигнал, хранящий серии в неявном декартовом дереве.
+ *
+ * Ключом узла служит его позиция во времени, которая не хранится, а вычисляется по суммарным
+ * длительностям поддеревьев. Подходит для редактирования длинных сигналов многими вставками;
+ * для последовательного доступа и хранения удобнее Complex_Signal, в который дерево преобразуется.
+ */
+class Complex_Signal_tree {
+  public:
+    /**
+     * @brief Конструктор по умолчанию. Создает пустой сигнал.
+     */
+    Complex_Signal_tree() = default;
+
+    /**
+     * @brief Конструктор, создающий сигнал из одной серии.
+     *
+     * @param level Уровень сигнала (0 или 1).
+     * @param duration Длительность сигнала.
+     */
+    Complex_Signal_tree(int level, int duration);
+
+    /**
+     * @brief Конструктор, создающий дерево из серий Complex_Signal.
+     *
+     * @param signal Сигнал с сериями в массиве.
+     */
+    explicit Complex_Signal_tree(const Complex_Signal& signal);
+
+    // Конструкторы копирования и перемещения
+    Complex_Signal_tree(const Complex_Signal_tree& other);
+    Complex_Signal_tree(Complex_Signal_tree&& other) noexcept = default;
+
+    // Операторы присваивания копированием и перемещением
+    Complex_Signal_tree& operator=(const Complex_Signal_tree& other);
+    Complex_Signal_tree& operator=(Complex_Signal_tree&& other) noexcept = default;
+
+    /**
+     * @brief Преобразует дерево в Complex_Signal с теми же сериями.
+     *
+     * @return Сигнал с сериями в массиве.
+     */
+    Complex_Signal to_complex_signal() const;
+
+    /**
+     * @brief Возвращает суммарную длительность сигнала.
+     *
+     * @return Длительность сигнала.
+     */
+    int get_duration() const;
+
+    /**
+     * @brief Оператор += для добавления другого сигнала в конец текущего.
+     *
+     * @param other Сигнал для добавления.
+     * @return Ссылка на текущий объект после добавления.
+     */
+    Complex_Signal_tree& operator+=(const Complex_Signal_tree& other);
+
+    /**
+     * @brief Вставляет копию другого сигнала на указанную позицию.
+     *
+     * @param other Сигнал для вставки.
+     * @param position Позиция вставки.
+     */
+    void insert(const Complex_Signal_tree& other, int position);
+
+    /**
+     * @brief Вставляет другой сигнал на указанную позицию, забирая его серии.
+     *
+     * @param other Сигнал для вставки; после вызова пуст.
+     * @param position Позиция вставки.
+     */
+    void insert(Complex_Signal_tree&& other, int position);
+
+    /**
+     * @brief Разрезает сигнал на указанной позиции.
+     *
+     * @param position Позиция разреза.
+     * @return Часть сигнала, начинающаяся с позиции; в текущем объекте остается часть до нее.
+     */
+    Complex_Signal_tree split(int position);
+
+    /**
+     * @brief Оператор [] для доступа к уровню сигнала на указанной позиции.
+     *
+     * @param position Позиция во времени.
+     * @return Уровень сигнала на данной позиции.
+     */
+    int operator[](int position) const;
+
+    /**
+     * @brief Форматированный вывод сигнала в выходной поток.
+     *
+     * @param out Поток для вывода.
+     */
+    void format_print(std::wostream& out) const;
+
+    /**
+     * @brief Оператор вывода для вывода сигнала в поток.
+     *
+     * @param out Поток вывода.
+     * @param signals Сигнал для вывода.
+     * @return Поток после вывода сигнала.
+     */
+    friend std::wostream& operator<<(std::wostream& out, const Complex_Signal_tree& signals);
+
+  private:
+    /**
+     * @struct Node
+     * @brief Узел дерева — одна серия сигнала.
+     */
+    struct Node {
+        Signal signal;               ///< Серия сигнала.
+        int total;                   ///< Суммарная длительность поддерева.
+        unsigned priority;           ///< Приоритет узла; у родителя не меньше, чем у детей.
+        std::unique_ptr<Node> left;  ///< Серии раньше данной.
+        std::unique_ptr<Node> right; ///< Серии позже данной.
+    };
+
+    std::unique_ptr<Node> root; ///< Корень дерева.
+
+    /**
+     * @brief Создает узел из одной серии со случайным приоритетом.
+     *
+     * @param signal Серия сигнала.
+     * @return Новый узел.
+     */
+    static std::unique_ptr<Node> make_node(const Signal& signal);
+
+    /**
+     * @brief Возвращает суммарную длительность поддерева.
+     *
+     * @param node Корень поддерева или nullptr.
+     * @return Суммарная длительность.
+     */
+    static int total(const std::unique_ptr<Node>& node);
+
+    /**
+     * @brief Пересчитывает суммарную длительность узла по детям.
+     *
+     * @param node Узел для пересчета.
+     */
+    static void update(Node& node);
+
+    /**
+     * @brief Сливает два дерева, все серии первого из которых раньше серий второго.
+     *
+     * @param left Дерево с ранними сериями.
+     * @param right Дерево с поздними сериями.
+     * @return Корень объединенного дерева.
+     */
+    static std::unique_ptr<Node> merge(std::unique_ptr<Node> left, std::unique_ptr<Node> right);
+
+    /**
+     * @brief Разрезает дерево по позиции, разделяя серию, которая ее накрывает.
+     *
+     * @param node Корень дерева.
+     * @param position Длительность левой части.
+     * @return Деревья с сериями до позиции и после нее.
+     */
+    static std::pair<std::unique_ptr<Node>, std::unique_ptr<Node>> cut(std::unique_ptr<Node> node, int position);
+
+    /**
+     * @brief Копирует поддерево.
+     *
+     * @param node Корень поддерева или nullptr.
+     * @return Корень копии.
+     */
+    static std::unique_ptr<Node> copy(const std::unique_ptr<Node>& node);
+
+    /**
+     * @brief Строит сбалансированное дерево из серий массива.
+     *
+     * @param first Указатель на первую серию.
+     * @param last Указатель за последнюю серию.
+     * @return Корень дерева.
+     */
+    static std::unique_ptr<Node> build(const Signals* first, const Signals* last);
+};
+
+std::wostream& operator<<(std::wostream& out, const Complex_Signal_tree& signals);
+
+#endif // LAB2_2_COMPLEX_SIGNAL_TREE_HPP
@@ -0,0 +1,147 @@
+/**
+ * @file complex_signal_view.cpp
+ * @brief Реализация класса Complex_Signal_view.
+ */
+
+#include "complex_signal_view.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Конструктор, создающий представление сигнала без изменений.
+ *
+ * @param signal Сигнал, на который ссылается представление.
+ */
+Complex_Signal_view::Complex_Signal_view(const Complex_Signal& signal) : signal(&signal) {}
+
+/**
+ * @brief Преобразует представление в Complex_Signal, применяя инверсию и растяжение к копии серий.
+ *
+ * @return Сигнал с сериями в массиве.
+ */
+Complex_Signal
+Complex_Signal_view::to_complex_signal() const {
+    Complex_Signal result(*signal);
+    std::for_each_n(result.signals.buffer_, result.signals.size_, [this](Signals& sig) {
+        if (inverted) {
+            sig.signal.inversion();
+        }
+        sig.signal.set_duration(sig.signal.get_duration() * scale);
+        sig.time *= scale;
+    });
+    return result;
+}
+
+/**
+ * @brief Возвращает длительность представления.
+ *
+ * @return Длительность сигнала, умноженная на множитель.
+ */
+int
+Complex_Signal_view::get_duration() const {
+    return base_duration() * scale;
+}
+
+/**
+ * @brief Инвертирует представление за O(1), не изменяя серии сигнала.
+ */
+void
+Complex_Signal_view::inversion() {
+    inverted ^= 1;
+}
+
+/**
+ * @brief Оператор инверсии ~ для инверсии представления.
+ *
+ * @return Ссылка на инвертированное представление.
+ */
+Complex_Signal_view&
+Complex_Signal_view::operator~() {
+    inversion();
+    return *this;
+}
+
+/**
+ * @brief Оператор [] для получения уровня сигнала в заданной позиции.
+ *
+ * Позиция делится на множитель, и серия ищется в исходном сигнале бинарным поиском.
+ *
+ * @param position Позиция в представлении.
+ * @return Уровень сигнала (0 или 1).
+ * @throws std::out_of_range если позиция недопустима.
+ */
+int
+Complex_Signal_view::operator[](int position) const {
+    if (position < 0 || position >= get_duration()) {
+        throw std::out_of_range("Invalid position: " + std::to_string(position));
+    }
+    int index = signal->bin_search(position / scale + 1);
+    return signal->signals.buffer_[index].signal.get_level() ^ inverted;
+}
+
+/**
+ * @brief Оператор * для растяжения представления во времени за O(1).
+ *
+ * @param multiplier Во сколько раз удлиняется каждая серия.
+ * @return Новое представление того же сигнала.
+ * @throws std::invalid_argument если multiplier отрицателен.
+ * @throws std::overflow_error если длительность результата превышает максимальное значение int.
+ */
+Complex_Signal_view
+Complex_Signal_view::operator*(int multiplier) const {
+    if (multiplier < 0) {
+        throw std::invalid_argument("Multiply value must be a non-negative integer");
+    }
+    if (multiplier > 1 && get_duration() > std::numeric_limits<int>::max() / multiplier) {
+        throw std::overflow_error("Signal is too long");
+    }
+    Complex_Signal_view result(*this);
+    // Для пустого сигнала множитель не растет, чтобы повторное растяжение не переполнило его.
+    if (base_duration() != 0 || multiplier == 0) {
+        result.scale *= multiplier;
+    }
+    return result;
+}
+
+/**
+ * @brief Форматированный вывод представления в выходной поток.
+ *
+ * Вывод совпадает с выводом сигнала, полученного to_complex_signal().
+ *
+ * @param out Поток для вывода.
+ */
+void
+Complex_Signal_view::format_print(std::wostream& out) const {
+    int last_level = -1;
+    std::for_each_n(signal->signals.buffer_, signal->signals.size_, [this, &out, &last_level](const Signals& sig) {
+        switch (last_level) {
+            case -1: break;
+            case 0: out << L'/'; break;
+            case 1: out << L'\\'; break;
+        }
+        last_level = sig.signal.get_level() ^ inverted;
+        Signal(last_level, sig.signal.get_duration() * scale).format_print(out);
+    });
+}
+
+/**
+ * @brief Возвращает длительность исходного сигнала.
+ *
+ * @return Длительность сигнала без растяжения.
+ */
+int
+Complex_Signal_view::base_duration() const {
+    const Allocator& runs = signal->signals;
+    return runs.size_ != 0 ? runs.buffer_[runs.size_ - 1].time : 0;
+}
+
+/**
+ * @brief Оператор вывода для Complex_Signal_view.
+ */
+std::wostream&
+operator<<(std::wostream& out, const Complex_Signal_view& view) {
+    view.format_print(out);
+    return out;
+}
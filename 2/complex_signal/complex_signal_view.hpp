@@ -0,0 +1,110 @@
+/**
+ * @file complex_signal_view.hpp
+ * @brief Определение класса Complex_Signal_view — инвертированного и растянутого во времени представления сигнала.
+ *
+ * Complex_Signal_view не копирует серии Complex_Signal, а хранит ссылку на сигнал, флаг инверсии
+ * и множитель длительности, которые применяются при доступе. Инверсия и растяжение представления
+ * выполняются за O(1); серии копируются только при преобразовании в Complex_Signal.
+ */
+
+#ifndef LAB2_2_COMPLEX_SIGNAL_VIEW_HPP
+#define LAB2_2_COMPLEX_SIGNAL_VIEW_HPP
+
+#include <ostream>
+#include "complex_signal.hpp"
+
+/**
+ * @class Complex_Signal_view
+ * @brief Представление Complex_Signal с отложенными инверсией и растяжением во времени.
+ *
+ * Как и std::string_view, представление не владеет сигналом: сигнал должен жить дольше представления,
+ * а после изменения сигнала представление показывает его новые серии.
+ */
+class Complex_Signal_view {
+  public:
+    /**
+     * @brief Конструктор, создающий представление сигнала без изменений.
+     *
+     * @param signal Сигнал, на который ссылается представление.
+     */
+    explicit Complex_Signal_view(const Complex_Signal& signal);
+
+    /**
+     * @brief Запрещает представление временного сигнала, который будет уничтожен раньше представления.
+     */
+    explicit Complex_Signal_view(const Complex_Signal&&) = delete;
+
+    /**
+     * @brief Преобразует представление в Complex_Signal, применяя инверсию и растяжение к копии серий.
+     *
+     * @return Сигнал с сериями в массиве.
+     */
+    Complex_Signal to_complex_signal() const;
+
+    /**
+     * @brief Возвращает длительность представления.
+     *
+     * @return Длительность сигнала, умноженная на множитель.
+     */
+    int get_duration() const;
+
+    /**
+     * @brief Инвертирует представление.
+     */
+    void inversion();
+
+    /**
+     * @brief Оператор инверсии ~ для инверсии представления.
+     *
+     * @return Ссылка на инвертированное представление.
+     */
+    Complex_Signal_view& operator~();
+
+    /**
+     * @brief Оператор [] для доступа к уровню сигнала на указанной позиции.
+     *
+     * @param position Позиция во времени.
+     * @return Уровень сигнала на данной позиции.
+     */
+    int operator[](int position) const;
+
+    /**
+     * @brief Оператор * для растяжения представления во времени, как у Complex_Signal.
+     *
+     * @param multiplier Во сколько раз удлиняется каждая серия.
+     * @return Новое представление того же сигнала.
+     */
+    Complex_Signal_view operator*(int multiplier) const;
+
+    /**
+     * @brief Форматированный вывод представления в выходной поток.
+     *
+     * @param out Поток для вывода.
+     */
+    void format_print(std::wostream& out) const;
+
+    /**
+     * @brief Оператор вывода для вывода представления в поток.
+     *
+     * @param out Поток вывода.
+     * @param view Представление для вывода.
+     * @return Поток после вывода представления.
+     */
+    friend std::wostream& operator<<(std::wostream& out, const Complex_Signal_view& view);
+
+  private:
+    const Complex_Signal* signal; ///< Сигнал, на который ссылается представление.
+    int inverted = 0;             ///< 1, если уровни инвертированы.
+    int scale = 1;                ///< Множитель длительности серий.
+
+    /**
+     * @brief Возвращает длительность исходного сигнала.
+     *
+     * @return Длительность сигнала без растяжения.
+     */
+    int base_duration() const;
+};
+
+std::wostream& operator<<(std::wostream& out, const Complex_Signal_view& view);
+
+#endif // LAB2_2_COMPLEX_SIGNAL_VIEW_HPP
@@ -4,8 +4,9 @@
  */
 
 #include "signal.hpp"
+#include <algorithm>
 #include <limits>
-#include <regex>
+#include <stdexcept>
 
 /**
  * @brief Конструктор Signal, инициализирующий объект с заданным уровнем и длительностью.
@@ -23,21 +24,21 @@ Signal::Signal(int level, int duration) {
 /**
  * @brief Конструктор Signal, инициализирующий объект из строки.
  * 
- * @param str Строка, содержащая последовательность нулей и единиц.
+ * @param str Строка, начинающаяся с последовательности нулей или единиц.
  * 
- * @throws std::invalid_argument Если строка не соответствует допустимому формату.
+ * @throws std::invalid_argument Если строка не начинается с 0 или 1.
+ * @throws std::overflow_error Если последовательность длиннее максимального значения int.
  */
 Signal::Signal(const std::string& str) {
-    std::regex pattern("^(0+|1+).*");
-    std::smatch matches;
-    std::string result;
-    if (std::regex_match(str, matches, pattern)) {
-        result = matches[1];
-        set_duration(result.length());
-        set_level(std::stoi(result.substr(0, 1)));
-    } else {
+    if (str.empty() || (str[0] != '0' && str[0] != '1')) {
         throw std::invalid_argument("Invalid input string: " + str);
     }
+    std::size_t duration = std::min(str.find_first_not_of(str[0]), str.size());
+    if (duration > static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+        throw std::overflow_error("Signal is too long");
+    }
+    set_duration(duration);
+    set_level(str[0] - '0');
 }
 
 /**
@@ -0,0 +1,44 @@
+#ifndef LAB2_2_TEST_HELPERS_HPP
+#define LAB2_2_TEST_HELPERS_HPP
+
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+// Builds a random string of levels with runs of up to max_run samples
+inline std::string
+random_levels(std::mt19937& random, int length, int max_run) {
+    std::string levels;
+    char level = '0' + random() % 2;
+    while (static_cast<int>(levels.size()) < length) {
+        levels.append(1 + random() % max_run, level);
+        level ^= 1;
+    }
+    levels.resize(length);
+    return levels;
+}
+
+// Returns the printed form of a signal
+template <typename Signal_type>
+std::wstring
+printed(const Signal_type& signal) {
+    std::wostringstream out;
+    out << signal;
+    return out.str();
+}
+
+// Checks every position of the signal against a string of levels
+template <typename Signal_type>
+void
+expect_levels(const Signal_type& signal, const std::string& levels) {
+    ASSERT_EQ(signal.get_duration(), static_cast<int>(levels.size()));
+    for (std::size_t i = 0; i < levels.size(); ++i) {
+        EXPECT_EQ(signal[i], levels[i] - '0') << levels << " at " << i;
+    }
+    EXPECT_THROW(signal[levels.size()], std::out_of_range);
+}
+
+#endif // LAB2_2_TEST_HELPERS_HPP
@@ -110,4 +110,59 @@ TEST(allocator_operator, move) {
     allocator2 = std::move(allocator);
     EXPECT_EQ(allocator2.size_, 0);
     EXPECT_EQ(allocator2.capacity_, 10);
-}
\ No newline at end of file
+}
+
+// Test the resize function with repeated appends
+TEST(allocator_resize, geometric_growth) {
+    Allocator allocator(3);
+    int reallocations = 0;
+    for (int i = 0; i < 1000; ++i) {
+        int capacity = allocator.capacity_;
+        allocator.resize(1);
+        reallocations += allocator.capacity_ != capacity;
+        allocator.buffer_[allocator.size_++] = Signals{Signal(i % 2, 1), i + 1};
+    }
+    EXPECT_EQ(allocator.capacity_, 1536);
+    EXPECT_EQ(reallocations, 9);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(allocator.buffer_[i].signal.get_level(), i % 2);
+        EXPECT_EQ(allocator.buffer_[i].time, i + 1);
+    }
+}
+
+// Test the reserve function
+TEST(allocator_reserve, reserve) {
+    Allocator allocator;
+    allocator.reserve(7);
+    EXPECT_EQ(allocator.capacity_, 7);
+    allocator.buffer_[allocator.size_++] = Signals{Signal(1, 2), 2};
+    allocator.reserve(5);
+    EXPECT_EQ(allocator.capacity_, 7);
+    allocator.reserve(100);
+    EXPECT_EQ(allocator.capacity_, 100);
+    EXPECT_EQ(allocator.size_, 1);
+    EXPECT_EQ(allocator.buffer_[0].time, 2);
+    EXPECT_THROW(allocator.reserve(-1), std::invalid_argument);
+}
+
+// Test the shrink_to_fit function
+TEST(allocator_shrink_to_fit, shrink_to_fit) {
+    Allocator allocator(10);
+    allocator.buffer_[allocator.size_++] = Signals{Signal(1, 3), 3};
+    allocator.shrink_to_fit();
+    EXPECT_EQ(allocator.capacity_, 1);
+    EXPECT_EQ(allocator.buffer_[0].time, 3);
+    allocator.size_ = 0;
+    allocator.shrink_to_fit();
+    EXPECT_EQ(allocator.capacity_, 0);
+    EXPECT_EQ(allocator.buffer_, nullptr);
+}
+
+// Test that the moved-from allocator is empty
+TEST(allocator_constructor, move_constructor_empties_source) {
+    Allocator allocator(10);
+    Allocator allocator2(std::move(allocator));
+    EXPECT_EQ(allocator.size_, 0);
+    EXPECT_EQ(allocator.capacity_, 0);
+    EXPECT_EQ(allocator.buffer_, nullptr);
+}
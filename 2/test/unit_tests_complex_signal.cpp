@@ -1,4 +1,9 @@
+#include <algorithm>
 #include <limits>
+#include <random>
+#include <vector>
+#include <sstream>
+#include <string>
 
 #include <gtest/gtest.h>
 #include "../complex_signal/complex_signal.hpp"
@@ -40,6 +45,39 @@ TEST(complex_signal_constructor, invalid_string_2) {
     EXPECT_THROW(Complex_Signal complex_signal(""), std::invalid_argument);
 }
 
+// Test the constructor with random binary strings of every length around the word size
+TEST(complex_signal_constructor, random_strings) {
+    std::mt19937 random(17);
+    for (int length = 1; length <= 80; ++length) {
+        for (int round = 0; round < 20; ++round) {
+            std::string str;
+            for (int i = 0; i < length; ++i) {
+                str += round % 2 == 0 ? char('0' + random() % 2) : char('0' + random() % 16 / 15);
+            }
+            Complex_Signal complex_signal(str + "2" + str);
+            for (int i = 0; i < length; ++i) {
+                EXPECT_EQ(complex_signal[i], str[i] - '0') << str << " at " << i;
+            }
+            EXPECT_THROW(complex_signal[length], std::out_of_range) << str;
+        }
+    }
+}
+
+// Test the constructor with a long string of alternating levels
+TEST(complex_signal_constructor, alternating_string) {
+    std::string str;
+    for (int i = 0; i < 1000; ++i) {
+        str += "01";
+    }
+    Complex_Signal complex_signal(str);
+    std::wostringstream out;
+    complex_signal.format_print(out);
+    EXPECT_EQ(out.str().size(), 2000 + 1999);
+    EXPECT_EQ(complex_signal[1998], 0);
+    EXPECT_EQ(complex_signal[1999], 1);
+    EXPECT_THROW(complex_signal[2000], std::out_of_range);
+}
+
 // Test operator square brackets with valid positions
 TEST(complex_signal_operator, square_brackets_valid_position) {
     Complex_Signal complex_signal("001110");
@@ -170,6 +208,54 @@ TEST(complex_signal_operator, addition_yourself) {
     EXPECT_EQ(complex_signal[5], 1);
 }
 
+// Test the addition operator merging runs of the same level at the boundary
+TEST(complex_signal_operator, addition_merges_boundary) {
+    Complex_Signal complex_signal("0011");
+    complex_signal += Complex_Signal("1100");
+    complex_signal += Complex_Signal("0");
+    std::wostringstream out;
+    out << complex_signal;
+    EXPECT_EQ(out.str(), std::wstring(L"__/‾‾‾‾\\___"));
+    EXPECT_EQ(complex_signal[5], 1);
+    EXPECT_EQ(complex_signal[6], 0);
+    EXPECT_EQ(complex_signal[8], 0);
+    EXPECT_THROW(complex_signal[9], std::out_of_range);
+}
+
+// Test the addition operator yourself with runs of the same level at the boundary
+TEST(complex_signal_operator, addition_yourself_merges_boundary) {
+    Complex_Signal complex_signal("0110");
+    complex_signal += complex_signal;
+    complex_signal += complex_signal;
+    std::wostringstream out;
+    out << complex_signal;
+    EXPECT_EQ(out.str(), std::wstring(L"_/‾‾\\__/‾‾\\__/‾‾\\__/‾‾\\_"));
+}
+
+// Test the addition operator with empty signals
+TEST(complex_signal_operator, addition_empty) {
+    Complex_Signal complex_signal, empty;
+    complex_signal += empty;
+    EXPECT_THROW(complex_signal[0], std::out_of_range);
+    complex_signal += Complex_Signal("10");
+    complex_signal += empty;
+    EXPECT_EQ(complex_signal[0], 1);
+    EXPECT_EQ(complex_signal[1], 0);
+    EXPECT_THROW(complex_signal[2], std::out_of_range);
+}
+
+// Test the addition operator with many short signals
+TEST(complex_signal_operator, addition_many) {
+    Complex_Signal complex_signal, piece("011");
+    for (int i = 0; i < 1000; ++i) {
+        complex_signal += piece;
+    }
+    for (int i = 0; i < 3000; ++i) {
+        EXPECT_EQ(complex_signal[i], i % 3 == 0 ? 0 : 1);
+    }
+    EXPECT_THROW(complex_signal[3000], std::out_of_range);
+}
+
 // Test the addition operator sequentially
 TEST(complex_signal_operator, addition_sequentially) {
     Complex_Signal complex_signal("001");
@@ -333,4 +419,92 @@ TEST(complex_signal_operator, input) {
     EXPECT_EQ(complex_signal[3], 1);
     EXPECT_EQ(complex_signal[4], 1);
     EXPECT_EQ(complex_signal[5], 0);
-}
\ No newline at end of file
+}
+
+// Builds a string of levels sample by sample from two signals of the same duration
+static std::string
+reference_levels(const Complex_Signal& first, const Complex_Signal& second, int duration, int (*operation)(int, int)) {
+    std::string levels;
+    for (int i = 0; i < duration; ++i) {
+        levels += char('0' + operation(first[i], second[i]));
+    }
+    return levels;
+}
+
+// Test the bitwise operators against a per-sample reference
+TEST(complex_signal_operator, bitwise_random) {
+    std::mt19937 random(22);
+    std::pair<Complex_Signal (Complex_Signal::*)(const Complex_Signal&) const, int (*)(int, int)> operations[] = {
+        {&Complex_Signal::operator&, [](int a, int b) { return a & b; }},
+        {&Complex_Signal::operator|, [](int a, int b) { return a | b; }},
+        {&Complex_Signal::operator^, [](int a, int b) { return a ^ b; }},
+    };
+    for (int length = 1; length <= 120; length += 17) {
+        std::string first_levels, second_levels;
+        for (int i = 0; i < length; ++i) {
+            first_levels += char('0' + random() % 2);
+            second_levels += char('0' + (random() % 4 == 0));
+        }
+        Complex_Signal first(first_levels), second(second_levels);
+        for (auto [member, operation] : operations) {
+            Complex_Signal result = (first.*member)(second);
+            std::wostringstream result_out, expected_out;
+            result_out << result;
+            expected_out << Complex_Signal(reference_levels(first, second, length, operation));
+            EXPECT_EQ(result_out.str(), expected_out.str()) << first_levels << " " << second_levels;
+            EXPECT_THROW(result[length], std::out_of_range);
+        }
+    }
+}
+
+// Test the bitwise operators on the same signal and on signals of different duration
+TEST(complex_signal_operator, bitwise_special) {
+    Complex_Signal signal("0011010");
+    std::wostringstream same_out, xor_out;
+    same_out << (signal & signal);
+    xor_out << (signal ^ signal);
+    EXPECT_EQ(same_out.str(), std::wstring(L"__/‾‾\\_/‾\\_"));
+    EXPECT_EQ(xor_out.str(), std::wstring(L"_______"));
+    EXPECT_THROW(signal | Complex_Signal("00"), std::invalid_argument);
+    EXPECT_THROW((Complex_Signal() | Complex_Signal())[0], std::out_of_range);
+}
+
+// Test the batch sampling with sorted and unsorted positions against the operator []
+TEST(complex_signal_sample, random) {
+    std::mt19937 random(24);
+    std::string levels;
+    for (int i = 0; i < 500; ++i) {
+        levels.append(1 + random() % 6, char('0' + i % 2));
+    }
+    Complex_Signal complex_signal(levels);
+    int duration = levels.size();
+    for (int count : {1, 7, 100, 3000}) {
+        std::vector<int> positions(count);
+        for (int& position : positions) {
+            position = random() % duration;
+        }
+        positions.back() = duration - 1;
+        for (int sorted = 0; sorted < 2; ++sorted) {
+            if (sorted) {
+                std::sort(positions.begin(), positions.end());
+            }
+            std::vector<int> out(count, -1);
+            complex_signal.sample(positions, out);
+            for (int i = 0; i < count; ++i) {
+                EXPECT_EQ(out[i], levels[positions[i]] - '0') << "position " << positions[i];
+            }
+        }
+    }
+}
+
+// Test the batch sampling with invalid arguments
+TEST(complex_signal_sample, invalid) {
+    Complex_Signal complex_signal("0011");
+    std::vector<int> positions = {0, 3, 4}, out(3);
+    EXPECT_THROW(complex_signal.sample(positions, out), std::out_of_range);
+    positions[2] = -1;
+    EXPECT_THROW(complex_signal.sample(positions, out), std::out_of_range);
+    EXPECT_THROW(complex_signal.sample(positions, std::span<int>(out).first(2)), std::invalid_argument);
+    EXPECT_NO_THROW(Complex_Signal().sample({}, {}));
+    EXPECT_THROW(Complex_Signal().sample(positions, out), std::out_of_range);
+}
@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+#include "../complex_signal/complex_signal_bits.hpp"
+#include "test_helpers.hpp"
+
+// Test the constructor level and duration
+TEST(complex_signal_bits_constructor, level_duration) {
+    Complex_Signal_bits signal(1, 70);
+    expect_levels(signal, std::string(70, '1'));
+    EXPECT_EQ(signal.count(), 70);
+    EXPECT_THROW(Complex_Signal_bits(2, 1), std::invalid_argument);
+    EXPECT_THROW(Complex_Signal_bits(1, -1), std::invalid_argument);
+}
+
+// Test the constructor with strings
+TEST(complex_signal_bits_constructor, string) {
+    expect_levels(Complex_Signal_bits("001a110"), "001");
+    expect_levels(Complex_Signal_bits("0101010111110000x1"), "0101010111110000");
+    EXPECT_THROW(Complex_Signal_bits("a001110"), std::invalid_argument);
+    EXPECT_THROW(Complex_Signal_bits(""), std::invalid_argument);
+}
+
+// Test the conversion from and to Complex_Signal with random strings
+TEST(complex_signal_bits_constructor, complex_signal) {
+    std::mt19937 random(21);
+    for (int length = 1; length <= 200; length += 7) {
+        std::string levels = random_levels(random, length, 1 + length % 9);
+        Complex_Signal complex_signal(levels);
+        Complex_Signal_bits from_string(levels), from_runs(complex_signal);
+        expect_levels(from_string, levels);
+        expect_levels(from_runs, levels);
+        EXPECT_EQ(printed(from_string), printed(complex_signal)) << levels;
+        EXPECT_EQ(printed(from_string.to_complex_signal()), printed(complex_signal)) << levels;
+    }
+}
+
+// Test the inversion and count
+TEST(complex_signal_bits_inversion, inversion) {
+    std::mt19937 random(22);
+    std::string levels = random_levels(random, 130, 3);
+    Complex_Signal_bits signal(levels);
+    int ones = std::count(levels.begin(), levels.end(), '1');
+    EXPECT_EQ(signal.count(), ones);
+    ~signal;
+    for (char& c : levels) {
+        c ^= 1;
+    }
+    expect_levels(signal, levels);
+    EXPECT_EQ(signal.count(), 130 - ones);
+}
+
+// Test the multiply operator against Complex_Signal
+TEST(complex_signal_bits_operator, multiply) {
+    std::mt19937 random(23);
+    std::string levels = random_levels(random, 100, 5);
+    Complex_Signal complex_signal(levels);
+    Complex_Signal_bits signal(levels);
+    for (int multiplier : {1, 2, 3, 7, 8, 9, 64, 65}) {
+        EXPECT_EQ(printed(signal * multiplier), printed(complex_signal * multiplier)) << multiplier;
+        EXPECT_EQ((signal * multiplier).count(), signal.count() * multiplier);
+    }
+    EXPECT_EQ((signal * 0).get_duration(), 0);
+    EXPECT_THROW(signal * -1, std::invalid_argument);
+}
+
+// Test the choice of the cheaper representation
+TEST(complex_signal_bits_cheaper, is_cheaper) {
+    std::string toggling, steady(1000, '1');
+    for (int i = 0; i < 500; ++i) {
+        toggling += "01";
+    }
+    EXPECT_TRUE(Complex_Signal_bits::is_cheaper(Complex_Signal(toggling)));
+    EXPECT_FALSE(Complex_Signal_bits::is_cheaper(Complex_Signal(steady)));
+    EXPECT_FALSE(Complex_Signal_bits::is_cheaper(Complex_Signal()));
+}
+
+// Test the bitwise operators against Complex_Signal
+TEST(complex_signal_bits_operator, bitwise) {
+    std::mt19937 random(24);
+    for (int length = 1; length <= 200; length += 13) {
+        std::string first_levels = random_levels(random, length, 4);
+        std::string second_levels = random_levels(random, length, 9);
+        Complex_Signal first(first_levels), second(second_levels);
+        Complex_Signal_bits first_bits(first_levels), second_bits(second_levels);
+        EXPECT_EQ(printed(first_bits & second_bits), printed(first & second)) << first_levels << " " << second_levels;
+        EXPECT_EQ(printed(first_bits | second_bits), printed(first | second)) << first_levels << " " << second_levels;
+        EXPECT_EQ(printed(first_bits ^ second_bits), printed(first ^ second)) << first_levels << " " << second_levels;
+        EXPECT_EQ((first_bits ^ second_bits).get_duration(), length);
+    }
+    EXPECT_THROW(Complex_Signal_bits("01") & Complex_Signal_bits("011"), std::invalid_argument);
+}
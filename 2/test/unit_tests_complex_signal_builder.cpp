@@ -0,0 +1,72 @@
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include "../complex_signal/complex_signal_builder.hpp"
+#include "test_helpers.hpp"
+
+// Test the builder with chunks split inside runs and at run boundaries
+TEST(complex_signal_builder_append, chunks) {
+    Complex_Signal_builder builder;
+    builder.append("0011");
+    builder.append("1100");
+    builder.append("0");
+    EXPECT_FALSE(builder.done());
+    EXPECT_EQ(printed(builder.build()), printed(Complex_Signal("001111000")));
+    builder.append("1");
+    EXPECT_EQ(printed(builder.build()), printed(Complex_Signal("1")));
+}
+
+// Test the builder stops at the first character other than 0 and 1
+TEST(complex_signal_builder_append, stops) {
+    Complex_Signal_builder builder;
+    builder.append("0110");
+    builder.append("01a1");
+    EXPECT_TRUE(builder.done());
+    builder.append("1111");
+    EXPECT_EQ(printed(builder.build()), printed(Complex_Signal("011001")));
+    builder.append("x01");
+    EXPECT_THROW(builder.build(), std::invalid_argument);
+    EXPECT_THROW(builder.build(), std::invalid_argument);
+}
+
+// Test the builder with a string longer than several chunks
+TEST(complex_signal_builder_append, long_string) {
+    std::mt19937 random(25);
+    std::string levels = random_levels(random, 3 * Complex_Signal_builder::CHUNK_SIZE + 17, 40);
+    Complex_Signal_builder builder;
+    builder.append(levels);
+    EXPECT_EQ(printed(builder.build()), printed(Complex_Signal(levels)));
+}
+
+// Test operator >> with several words and a word longer than a chunk
+TEST(complex_signal_builder_input, words) {
+    std::mt19937 random(26);
+    std::string levels = random_levels(random, 2 * Complex_Signal_builder::CHUNK_SIZE + 5, 9);
+    std::istringstream in("  0110\n" + levels + " 10a1 b1");
+    Complex_Signal first, second, third;
+    in >> first >> second >> third;
+    EXPECT_EQ(printed(first), printed(Complex_Signal("0110")));
+    EXPECT_EQ(printed(second), printed(Complex_Signal(levels)));
+    EXPECT_EQ(printed(third), printed(Complex_Signal("10")));
+    EXPECT_THROW(in >> third, std::invalid_argument);
+    EXPECT_EQ(printed(third), printed(Complex_Signal("10")));
+    EXPECT_THROW(in >> third, std::invalid_argument);
+    EXPECT_TRUE(in.eof());
+}
+
+// Test reading a signal from a file
+TEST(complex_signal_builder_file, read_file) {
+    std::mt19937 random(27);
+    std::string levels = random_levels(random, 20 * Complex_Signal_builder::CHUNK_SIZE + 3, 1000);
+    std::string path = testing::TempDir() + "complex_signal_builder_test.txt";
+    std::ofstream(path) << "\n " << levels << "\n0101";
+    EXPECT_EQ(printed(Complex_Signal_builder::read_file(path)), printed(Complex_Signal(levels)));
+    std::ofstream(path) << " \n";
+    EXPECT_THROW(Complex_Signal_builder::read_file(path), std::invalid_argument);
+    std::remove(path.c_str());
+    EXPECT_THROW(Complex_Signal_builder::read_file(path), std::runtime_error);
+}
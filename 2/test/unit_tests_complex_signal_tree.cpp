@@ -0,0 +1,105 @@
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+#include "../complex_signal/complex_signal_tree.hpp"
+#include "test_helpers.hpp"
+
+// Test the constructor level and duration
+TEST(complex_signal_tree_constructor, level_duration) {
+    Complex_Signal_tree tree(1, 10);
+    EXPECT_EQ(tree.get_duration(), 10);
+    EXPECT_EQ(tree[0], 1);
+    EXPECT_EQ(tree[9], 1);
+    EXPECT_THROW(tree[10], std::out_of_range);
+    EXPECT_THROW(tree[-1], std::out_of_range);
+}
+
+// Test the conversion from and to Complex_Signal
+TEST(complex_signal_tree_constructor, complex_signal) {
+    Complex_Signal complex_signal("0010111011");
+    Complex_Signal_tree tree(complex_signal);
+    expect_levels(tree, "0010111011");
+    EXPECT_EQ(printed(tree), std::wstring(L"__/‾\\_/‾‾‾\\_/‾‾"));
+    EXPECT_EQ(printed(tree.to_complex_signal()), printed(tree));
+}
+
+// Test the empty tree
+TEST(complex_signal_tree_constructor, empty) {
+    Complex_Signal_tree tree;
+    EXPECT_EQ(tree.get_duration(), 0);
+    EXPECT_THROW(tree[0], std::out_of_range);
+    EXPECT_THROW(tree.insert(Complex_Signal_tree(1, 1), 0), std::out_of_range);
+    tree += Complex_Signal_tree(1, 2);
+    expect_levels(tree, "11");
+}
+
+// Test the copy constructor and the copy assignment operator
+TEST(complex_signal_tree_constructor, copy) {
+    Complex_Signal_tree tree(Complex_Signal("0011"));
+    Complex_Signal_tree copy(tree);
+    Complex_Signal_tree assigned;
+    assigned = tree;
+    tree += tree;
+    expect_levels(tree, "00110011");
+    expect_levels(copy, "0011");
+    expect_levels(assigned, "0011");
+}
+
+// Test the insertion at the beginning, inside a run and at a run boundary
+TEST(complex_signal_tree_insert, positions) {
+    Complex_Signal_tree tree(Complex_Signal("00111"));
+    tree.insert(Complex_Signal_tree(Complex_Signal("010")), 3);
+    expect_levels(tree, "00101011");
+    tree.insert(Complex_Signal_tree(1, 2), 0);
+    expect_levels(tree, "1100101011");
+    tree.insert(tree, 2);
+    expect_levels(tree, "11110010101100101011");
+    EXPECT_THROW(tree.insert(tree, 20), std::out_of_range);
+    EXPECT_THROW(tree.insert(tree, -1), std::out_of_range);
+}
+
+// Test the insertion with the same runs as Complex_Signal::insert
+TEST(complex_signal_tree_insert, same_as_complex_signal) {
+    Complex_Signal complex_signal("00111");
+    Complex_Signal_tree tree(complex_signal);
+    complex_signal.insert(Complex_Signal("010"), 3);
+    tree.insert(Complex_Signal_tree(Complex_Signal("010")), 3);
+    EXPECT_EQ(printed(tree), printed(complex_signal));
+}
+
+// Test the split
+TEST(complex_signal_tree_split, split) {
+    Complex_Signal_tree tree(Complex_Signal("0011100"));
+    Complex_Signal_tree right = tree.split(3);
+    expect_levels(tree, "001");
+    expect_levels(right, "1100");
+    Complex_Signal_tree empty = tree.split(3);
+    EXPECT_EQ(empty.get_duration(), 0);
+    EXPECT_THROW(tree.split(4), std::out_of_range);
+    EXPECT_THROW(tree.split(-1), std::out_of_range);
+}
+
+// Test random insertions and splits against a string of levels
+TEST(complex_signal_tree_insert, random) {
+    std::mt19937 random(18);
+    std::string levels = "0110";
+    Complex_Signal_tree tree{Complex_Signal(levels)};
+    for (int round = 0; round < 300; ++round) {
+        std::string piece;
+        for (int i = 1 + random() % 6; i > 0; --i) {
+            piece += char('0' + random() % 2);
+        }
+        int position = random() % levels.size();
+        tree.insert(Complex_Signal_tree(Complex_Signal(piece)), position);
+        levels.insert(position, piece);
+        if (round % 50 == 49) {
+            int cut = random() % (levels.size() + 1);
+            Complex_Signal_tree right = tree.split(cut);
+            expect_levels(right, levels.substr(cut));
+            tree += right;
+        }
+    }
+    expect_levels(tree, levels);
+    expect_levels(Complex_Signal_tree(tree.to_complex_signal()), levels);
+}
@@ -0,0 +1,83 @@
+#include <limits>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+#include "../complex_signal/complex_signal_view.hpp"
+#include "test_helpers.hpp"
+
+// Checks the view against an eagerly transformed signal of the given duration
+static void
+expect_same(const Complex_Signal_view& view, const Complex_Signal& expected, int duration) {
+    ASSERT_EQ(view.get_duration(), duration);
+    for (int i = 0; i < duration; ++i) {
+        EXPECT_EQ(view[i], expected[i]) << " at " << i;
+    }
+    EXPECT_THROW(view[duration], std::out_of_range);
+    EXPECT_THROW(view[-1], std::out_of_range);
+    EXPECT_EQ(printed(view), printed(expected));
+    EXPECT_EQ(printed(view.to_complex_signal()), printed(expected));
+}
+
+// Test the view without changes
+TEST(complex_signal_view_constructor, signal) {
+    Complex_Signal signal("0011101");
+    Complex_Signal_view view(signal);
+    expect_same(view, signal, 7);
+}
+
+// Test the inversion of the view
+TEST(complex_signal_view_operator, inversion) {
+    Complex_Signal signal("0011101");
+    Complex_Signal_view view(signal);
+    ~view;
+    Complex_Signal expected(signal);
+    ~expected;
+    expect_same(view, expected, 7);
+    ~view;
+    expect_same(view, signal, 7);
+}
+
+// Test the multiply operator of the view
+TEST(complex_signal_view_operator, multiply) {
+    Complex_Signal signal("0011101");
+    Complex_Signal_view view(signal);
+    expect_same(view * 3, signal * 3, 21);
+    expect_same(view * 2 * 3, signal * 6, 42);
+    EXPECT_EQ((view * 0).get_duration(), 0);
+    EXPECT_THROW((view * 0)[0], std::out_of_range);
+    EXPECT_THROW(view * -1, std::invalid_argument);
+    EXPECT_THROW(view * (std::numeric_limits<int>::max() / 2), std::overflow_error);
+}
+
+// Test random sequences of inversions and multiplications against Complex_Signal
+TEST(complex_signal_view_operator, random) {
+    std::mt19937 random(23);
+    std::string levels;
+    for (int i = 0; i < 40; ++i) {
+        levels += char('0' + random() % 2);
+    }
+    Complex_Signal signal(levels), expected(levels);
+    Complex_Signal_view view(signal);
+    int duration = 40;
+    for (int round = 0; round < 6; ++round) {
+        if (random() % 2 == 0) {
+            ~view;
+            ~expected;
+        } else {
+            int multiplier = 1 + random() % 3;
+            view = view * multiplier;
+            expected = expected * multiplier;
+            duration *= multiplier;
+        }
+        expect_same(view, expected, duration);
+    }
+}
+
+// Test that the view follows changes of the signal
+TEST(complex_signal_view_constructor, follows_signal) {
+    Complex_Signal signal("01");
+    Complex_Signal_view view = Complex_Signal_view(signal) * 2;
+    signal += Complex_Signal("1");
+    expect_same(view, Complex_Signal("001111"), 6);
+}
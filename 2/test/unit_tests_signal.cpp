@@ -52,6 +52,13 @@ TEST(signal_constructor, should_initialize_signal_object_when_given_valid_binary
     EXPECT_EQ(signal.get_level(), 1);
 }
 
+// Initializes Signal object with a string of a single level
+TEST(signal_constructor, should_initialize_signal_object_when_given_single_level_string) {
+    Signal signal(std::string(100, '1'));
+    EXPECT_EQ(signal.get_duration(), 100);
+    EXPECT_EQ(signal.get_level(), 1);
+}
+
 // Initializes Signal object with invalid string
 TEST(signal_constructor, should_initialize_signal_object_when_given_invalid_string) {
     std::string invalid_binary_string = "qq111aaa";